@@ -5,6 +5,7 @@
 
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemLog.h"
+#include "GameplayEffectAggregator.h"
 #include "ActionGameRuntime/Character/ActionGameCharacter.h"
 
 
@@ -12,48 +13,47 @@ void UAG_GameplayAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handl
 {
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 
+	UAbilitySystemComponent* AbilityComponent = ActorInfo->AbilitySystemComponent.Get();
 
-	FGameplayEffectContextHandle EffectContext = ActorInfo->AbilitySystemComponent->MakeEffectContext();
+	if (!AbilityComponent)
+	{
+		return;
+	}
 
-	for (auto GameplayEffect : OngoingEffectsToJustApplyOnStart)
+	const int32 Level = GetAbilityLevel(Handle, ActorInfo);
+
+	FEffectSpecCache NonInstancedSpecs;
+	FEffectSpecCache& Specs = IsInstantiated() ? EffectSpecCache : NonInstancedSpecs;
+
+	if (Specs.Level != Level || Specs.AbilitySystemComponent.Get() != AbilityComponent)
 	{
-		if (!GameplayEffect.Get()) continue;
+		BuildEffectSpecs(AbilityComponent, Level, Specs);
+	}
+
+	// Attributes touched by several of these effects only update their aggregators once.
+	FScopedAggregatorOnDirtyBatch AggregatorBatch;
 
-		if (UAbilitySystemComponent* AbilityComponent = ActorInfo->AbilitySystemComponent.Get())
+	for (const FGameplayEffectSpecHandle& SpecHandle : Specs.ApplyOnStartSpecs)
+	{
+		FActiveGameplayEffectHandle ActiveGEHandle = AbilityComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+		if (!ActiveGEHandle.WasSuccessfullyApplied())
 		{
-			FGameplayEffectSpecHandle SpecHandle = AbilityComponent->MakeOutgoingSpec(GameplayEffect, 1, EffectContext);
-			if (SpecHandle.IsValid())
-			{
-				FActiveGameplayEffectHandle ActiveGEHandle = AbilityComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-				if (!ActiveGEHandle.WasSuccessfullyApplied())
-				{
-					ABILITY_LOG(Log, TEXT("Ability %s failed to apply startup effect %s"), *GetName(), *GetNameSafe(GameplayEffect));
-				}
-			}
+			ABILITY_LOG(Log, TEXT("Ability %s failed to apply startup effect %s"), *GetName(), *GetNameSafe(SpecHandle.Data->Def));
 		}
 	}
 
 	if (IsInstantiated())
 	{
-		for (auto GameplayEffect : OngoingEffectsToRemoveOnEnd)
+		for (const FGameplayEffectSpecHandle& SpecHandle : Specs.RemoveOnEndSpecs)
 		{
-			if (!GameplayEffect.Get()) continue;
-
-			if (UAbilitySystemComponent* AbilityComponent = ActorInfo->AbilitySystemComponent.Get())
+			FActiveGameplayEffectHandle ActiveGEHandle = AbilityComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
+			if (!ActiveGEHandle.WasSuccessfullyApplied())
+			{
+				ABILITY_LOG(Log, TEXT("Ability %s failed to apply runtime effect %s"), *GetName(), *GetNameSafe(SpecHandle.Data->Def));
+			}
+			else
 			{
-				FGameplayEffectSpecHandle SpecHandle = AbilityComponent->MakeOutgoingSpec(GameplayEffect, 1, EffectContext);
-				if (SpecHandle.IsValid())
-				{
-					FActiveGameplayEffectHandle ActiveGEHandle = AbilityComponent->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get());
-					if (!ActiveGEHandle.WasSuccessfullyApplied())
-					{
-						ABILITY_LOG(Log, TEXT("Ability %s failed to apply runtime effect %s"), *GetName(), *GetNameSafe(GameplayEffect));
-					}
-					else
-					{
-						RemoveOnEndEffectHandles.Add(ActiveGEHandle);
-					}
-				}
+				RemoveOnEndEffectHandles.Add(ActiveGEHandle);
 			}
 		}
 	}
@@ -63,6 +63,8 @@ void UAG_GameplayAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, co
 {
 	if (IsInstantiated())
 	{
+		FScopedAggregatorOnDirtyBatch AggregatorBatch;
+
 		for (FActiveGameplayEffectHandle ActiveEffectHandle : RemoveOnEndEffectHandles)
 		{
 			if (ActiveEffectHandle.IsValid())
@@ -71,12 +73,48 @@ void UAG_GameplayAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, co
 			}
 		}
 
-		RemoveOnEndEffectHandles.Empty();
+		// Keep the allocation around for the next activation.
+		RemoveOnEndEffectHandles.Reset();
 	}
 	
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
 
+void UAG_GameplayAbility::BuildEffectSpecs(UAbilitySystemComponent* AbilityComponent, int32 Level, FEffectSpecCache& OutSpecs) const
+{
+	OutSpecs.Level = Level;
+	OutSpecs.AbilitySystemComponent = AbilityComponent;
+	OutSpecs.ApplyOnStartSpecs.Reset();
+	OutSpecs.RemoveOnEndSpecs.Reset();
+
+	FGameplayEffectContextHandle EffectContext = AbilityComponent->MakeEffectContext();
+
+	for (auto GameplayEffect : OngoingEffectsToJustApplyOnStart)
+	{
+		if (!GameplayEffect.Get()) continue;
+
+		FGameplayEffectSpecHandle SpecHandle = AbilityComponent->MakeOutgoingSpec(GameplayEffect, Level, EffectContext);
+		if (SpecHandle.IsValid())
+		{
+			OutSpecs.ApplyOnStartSpecs.Add(SpecHandle);
+		}
+	}
+
+	if (IsInstantiated())
+	{
+		for (auto GameplayEffect : OngoingEffectsToRemoveOnEnd)
+		{
+			if (!GameplayEffect.Get()) continue;
+
+			FGameplayEffectSpecHandle SpecHandle = AbilityComponent->MakeOutgoingSpec(GameplayEffect, Level, EffectContext);
+			if (SpecHandle.IsValid())
+			{
+				OutSpecs.RemoveOnEndSpecs.Add(SpecHandle);
+			}
+		}
+	}
+}
+
 AActionGameCharacter* UAG_GameplayAbility::GetActionGameCharacterFromActorInfo() const
 {
 	return Cast<AActionGameCharacter>(GetAvatarActorFromActorInfo());
@@ -27,6 +27,21 @@ protected:
 	
 	TArray<FActiveGameplayEffectHandle> RemoveOnEndEffectHandles;
 
+	// Specs for the effects above, built once per ability level and reused on every activation.
+	// Effects that snapshot source attributes keep the values from when the specs were built.
+	struct FEffectSpecCache
+	{
+		int32 Level = INDEX_NONE;
+		TWeakObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
+		TArray<FGameplayEffectSpecHandle> ApplyOnStartSpecs;
+		TArray<FGameplayEffectSpecHandle> RemoveOnEndSpecs;
+	};
+
+	// Only used by instanced abilities, non-instanced ones build their specs on each activation.
+	FEffectSpecCache EffectSpecCache;
+
+	void BuildEffectSpecs(UAbilitySystemComponent* AbilityComponent, int32 Level, FEffectSpecCache& OutSpecs) const;
+
 	UFUNCTION(BlueprintCallable, BlueprintPure)
 	AActionGameCharacter* GetActionGameCharacterFromActorInfo() const;
 };
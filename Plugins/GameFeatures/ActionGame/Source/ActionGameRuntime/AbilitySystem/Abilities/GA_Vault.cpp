@@ -4,12 +4,13 @@
 #include "GA_Vault.h"
 
 #include "ActionGameRuntime/Character/ActionGameCharacter.h"
-#include "Kismet/KismetSystemLibrary.h"
 #include "DrawDebugHelpers.h"
 #include "Abilities/Tasks/AbilityTask_PlayMontageAndWait.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "ActionGameRuntime/Character/CommonMotionWarpingComponent.h"
+#include "ActionGameRuntime/Character/TraversalQuerySubsystem.h"
+#include "ActionGameRuntime/Character/RDCharacterMovementComponent2.h"
 
 
 UGA_Vault::UGA_Vault()
@@ -34,16 +35,148 @@ bool UGA_Vault::CommitCheck(const FGameplayAbilitySpecHandle Handle, const FGame
 
 	const FVector StartLocation = Character->GetActorLocation();
 	const FVector ForwardVector = Character->GetActorForwardVector();
-	const FVector UpVector = Character->GetActorUpVector();
-
-	TArray<AActor*> ActorsToIgnore = {Character};
 
 	static const auto CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("ShowDebugTraversal"));
-	const bool bShowTraversal = CVar->GetInt() > 0;
+	const bool bShowTraversal = CVar && CVar->GetInt() > 0;
+
+	FVaultTraceParams TraceParams;
+	TraceParams.QueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(VaultTrace), true, Character);
+	TraceParams.ObjectQueryParams = FCollisionObjectQueryParams(TraceObjectTypes);
+	TraceParams.bDrawDebug = bShowTraversal;
+
+	UTraversalQuerySubsystem* TraversalQuery = GetWorld()->GetSubsystem<UTraversalQuerySubsystem>();
+
+	// Reuse an edge found by an earlier scan when the capsule reaches one ahead, confirming it is still there. The
+	// heights match the range the horizontal column covers.
+	if (TraversalQuery)
+	{
+		const float CapsuleRadius = Character->GetCapsuleComponent()->GetScaledCapsuleRadius();
+		const float MinEdgeHeight = -HorizontalTraceRadius;
+		const float MaxEdgeHeight = (FMath::CeilToInt(HorizontalTraceCount) - 1) * HorizontalTraceStep + HorizontalTraceRadius;
+
+		FTraversalVaultCandidate Candidate;
+
+		if (TraversalQuery->FindVaultCandidate(GetClass(), StartLocation, ForwardVector, CapsuleRadius, HorizontalTraceLength, MinEdgeHeight, MaxEdgeHeight, Candidate) && ConfirmVaultCandidate(Candidate, TraceParams))
+		{
+			if (bShowTraversal)
+			{
+				DrawDebugSphere(GetWorld(), JumpToLocation, 15, 16, FColor::Green, false, 7);
+				DrawDebugSphere(GetWorld(), JumpOverLocation, 15, 16, FColor::Green, false, 7);
+			}
+
+			return true;
+		}
+
+		if (TraversalQuery->HasRecentVaultMiss(GetClass(), StartLocation, ForwardVector))
+		{
+			return false;
+		}
+	}
+
+	bool bOnlyStaticHits = true;
+	UPrimitiveComponent* VaultComponent = nullptr;
+	FVector EdgeNormal = -ForwardVector;
+
+	const bool bCanVault = TraceVaultLocations(Character, TraceParams, bOnlyStaticHits, VaultComponent, EdgeNormal);
+
+	// Only static geometry is cached, anything that can move has to be traced every time.
+	if (TraversalQuery && bOnlyStaticHits)
+	{
+		if (!bCanVault)
+		{
+			TraversalQuery->AddVaultMiss(GetClass(), StartLocation, ForwardVector);
+		}
+		else if (VaultComponent)
+		{
+			TraversalQuery->AddVaultEdge(GetClass(), JumpToLocation, JumpOverLocation, ForwardVector, EdgeNormal, VaultComponent);
+		}
+	}
+
+	if (bCanVault && bShowTraversal)
+	{
+		DrawDebugSphere(GetWorld(), JumpToLocation, 15, 16, FColor::White, false, 7);
+		DrawDebugSphere(GetWorld(), JumpOverLocation, 15, 16, FColor::White, false, 7);
+	}
+
+	return bCanVault;
+}
 
-	EDrawDebugTrace::Type DebugDrawType = bShowTraversal ? EDrawDebugTrace::ForDuration : EDrawDebugTrace::None;
+bool UGA_Vault::ConfirmVaultCandidate(const FTraversalVaultCandidate& Candidate, const FVaultTraceParams& TraceParams)
+{
+	// The cached edge may be approached from anywhere along it, so check this spot: one trace down onto the edge
+	// tells the top is still there at the cached height, starting a step above it so nothing sits on top.
+	const FVector TraceStart = Candidate.JumpToLocation + FVector::UpVector * VerticalTraceStep;
+	const FVector TraceEnd = Candidate.JumpToLocation - FVector::UpVector * VerticalTraceStep;
 
-	bool bJumpToLocationSet = false;
+	FHitResult TraceHit;
+
+	if (!SweepForVault(TraceStart, TraceEnd, VerticalTraceRadius, TraceParams, TraceHit) || TraceHit.bStartPenetrating)
+	{
+		return false;
+	}
+
+	if (TraceHit.GetComponent() != Candidate.Component.Get() || FMath::Abs(TraceHit.ImpactPoint.Z - Candidate.JumpToLocation.Z) > VerticalTraceStep * 0.5f)
+	{
+		return false;
+	}
+
+	const FVector NewJumpToLocation = TraceHit.ImpactPoint;
+	const FVector NewJumpOverLocation = Candidate.JumpOverLocation + FVector::UpVector * (TraceHit.ImpactPoint.Z - Candidate.JumpToLocation.Z);
+
+	// One trace across the top, just above it, tells the way over is clear to the far side.
+	const FVector ClearanceOffset = FVector::UpVector * (VerticalTraceRadius + 1.f);
+
+	if (SweepForVault(NewJumpToLocation + ClearanceOffset, NewJumpOverLocation + ClearanceOffset, VerticalTraceRadius, TraceParams, TraceHit))
+	{
+		return false;
+	}
+
+	JumpToLocation = NewJumpToLocation;
+	JumpOverLocation = NewJumpOverLocation;
+
+	return true;
+}
+
+bool UGA_Vault::SweepForVault(const FVector& TraceStart, const FVector& TraceEnd, float Radius, const FVaultTraceParams& TraceParams, FHitResult& OutHit) const
+{
+	const bool bHit = GetWorld()->SweepSingleByObjectType(OutHit, TraceStart, TraceEnd, FQuat::Identity, TraceParams.ObjectQueryParams, FCollisionShape::MakeSphere(Radius), TraceParams.QueryParams);
+
+	if (TraceParams.bDrawDebug)
+	{
+		DrawDebugLine(GetWorld(), TraceStart, bHit ? OutHit.Location : TraceEnd, bHit ? FColor::Green : FColor::Red, false, 5);
+
+		if (bHit)
+		{
+			DrawDebugSphere(GetWorld(), OutHit.Location, Radius, 12, FColor::Green, false, 5);
+		}
+	}
+
+	return bHit;
+}
+
+bool UGA_Vault::TraceVaultLocations(const AActionGameCharacter* Character, const FVaultTraceParams& TraceParams, bool& bOutOnlyStaticHits, UPrimitiveComponent*& OutVaultComponent, FVector& OutEdgeNormal)
+{
+	// The movement component traces the horizontal column every tick for all traversal abilities, reuse it when it matches our settings.
+	const URDCharacterMovementComponent2* MovementComponent = Cast<URDCharacterMovementComponent2>(Character->GetCharacterMovement());
+	const FTraversalTraceResults* SharedTraces = MovementComponent ? MovementComponent->GetTraversalTraceResults() : nullptr;
+
+	if (SharedTraces && !SharedTraces->IsCompatible(HorizontalTraceRadius, HorizontalTraceLength, FMath::CeilToInt(HorizontalTraceCount), HorizontalTraceStep, TraceParams.ObjectQueryParams, TraceParams.QueryParams.bTraceComplex, Character))
+	{
+		SharedTraces = nullptr;
+	}
+
+	const FVector StartLocation = SharedTraces ? SharedTraces->StartLocation : Character->GetActorLocation();
+	const FVector ForwardVector = SharedTraces ? SharedTraces->ForwardVector : Character->GetActorForwardVector();
+	const FVector UpVector = SharedTraces ? SharedTraces->UpVector : Character->GetActorUpVector();
+
+	bOutOnlyStaticHits = true;
+	OutVaultComponent = nullptr;
+
+	auto NoteHit = [&bOutOnlyStaticHits](const FHitResult& Hit)
+	{
+		const UPrimitiveComponent* HitComponent = Hit.GetComponent();
+		bOutOnlyStaticHits &= HitComponent && HitComponent->Mobility == EComponentMobility::Static;
+	};
 
 	int32 JumpToLocationIdx = INDEX_NONE;
 
@@ -58,12 +191,23 @@ bool UGA_Vault::CommitCheck(const FGameplayAbilitySpecHandle Handle, const FGame
 		const FVector TraceStart = StartLocation + i * UpVector * HorizontalTraceStep;
 		const FVector TraceEnd = TraceStart + ForwardVector * HorizontalTraceLength;
 
-		if (UKismetSystemLibrary::SphereTraceSingleForObjects(this, TraceStart, TraceEnd, HorizontalTraceRadius, TraceObjectTypes, true, ActorsToIgnore, DebugDrawType, TraceHit, true))
+		if (SharedTraces)
+		{
+			TraceHit = SharedTraces->Hits[i];
+		}
+
+		const bool bHit = SharedTraces ? TraceHit.bBlockingHit : SweepForVault(TraceStart, TraceEnd, HorizontalTraceRadius, TraceParams, TraceHit);
+
+		if (bHit)
 		{
+			NoteHit(TraceHit);
+
 			if (JumpToLocationIdx == INDEX_NONE && (i < HorizontalTraceCount - 1))
 			{
 				JumpToLocationIdx = i;
 				JumpToLocation = TraceHit.Location;
+				OutVaultComponent = TraceHit.GetComponent();
+				OutEdgeNormal = TraceHit.ImpactNormal;
 			}
 			else if (JumpToLocationIdx == (i - 1))
 			{
@@ -114,8 +258,10 @@ bool UGA_Vault::CommitCheck(const FGameplayAbilitySpecHandle Handle, const FGame
 		const FVector TraceStart = VerticalStartLocation + i * ForwardVector * VerticalTraceStep;
 		const FVector TraceEnd = TraceStart + UpVector * VerticalTraceLength * -1;
 
-		if (UKismetSystemLibrary::SphereTraceSingleForObjects(this, TraceStart, TraceEnd, HorizontalTraceRadius, TraceObjectTypes, true, ActorsToIgnore, DebugDrawType, TraceHit, true))
+		if (SweepForVault(TraceStart, TraceEnd, HorizontalTraceRadius, TraceParams, TraceHit))
 		{
+			NoteHit(TraceHit);
+
 			JumpOverLocation = TraceHit.ImpactPoint;
 
 			if (i == 0)
@@ -137,15 +283,11 @@ bool UGA_Vault::CommitCheck(const FGameplayAbilitySpecHandle Handle, const FGame
 
 	const FVector TraceStart = JumpOverLocation + ForwardVector * VerticalTraceStep;
 
-	if (UKismetSystemLibrary::SphereTraceSingleForObjects(this, TraceStart, JumpOverLocation, HorizontalTraceRadius, TraceObjectTypes, true, ActorsToIgnore, DebugDrawType, TraceHit, true))
+	if (SweepForVault(TraceStart, JumpOverLocation, HorizontalTraceRadius, TraceParams, TraceHit))
 	{
-		JumpOverLocation = TraceHit.ImpactPoint;
-	}
+		NoteHit(TraceHit);
 
-	if (bShowTraversal)
-	{
-		DrawDebugSphere(GetWorld(), JumpToLocation, 15, 16, FColor::White, false, 7);
-		DrawDebugSphere(GetWorld(), JumpOverLocation, 15, 16, FColor::White, false, 7);
+		JumpOverLocation = TraceHit.ImpactPoint;
 	}
 
 	return true;
@@ -187,7 +329,14 @@ void UGA_Vault::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const F
 		MotionWarpingComponent->AddOrUpdateWarpTargetFromLocationAndRotation(TEXT("JumpToLocation"), JumpToLocation, Character->GetActorRotation());
 		MotionWarpingComponent->AddOrUpdateWarpTargetFromLocationAndRotation(TEXT("JumpOverLocation"), JumpOverLocation, Character->GetActorRotation());
 
-		MotionWarpingComponent->SendWarpPointsToClients();
+		if (HasAuthority(&ActivationInfo))
+		{
+			MotionWarpingComponent->SendWarpPointsToClients(ActivationInfo.GetActivationPredictionKey());
+		}
+		else
+		{
+			MotionWarpingComponent->AddLocallyPredictedKey(ActivationInfo.GetActivationPredictionKey());
+		}
 	}
 
 	MontageTask = UAbilityTask_PlayMontageAndWait::CreatePlayMontageAndWaitProxy(this, NAME_None, VaultMontage);
@@ -231,6 +380,8 @@ void UGA_Vault::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGamep
 	{	
 		MotionWarpingComponent->RemoveWarpTarget(TEXT("JumpToLocation"));
 		MotionWarpingComponent->RemoveWarpTarget(TEXT("JumpOverLocation"));
+
+		MotionWarpingComponent->SendWarpPointsToClients();
 	}
 
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
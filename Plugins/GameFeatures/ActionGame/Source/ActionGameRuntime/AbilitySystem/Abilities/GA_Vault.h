@@ -4,10 +4,22 @@
 
 #include "CoreMinimal.h"
 #include "AG_GameplayAbility.h"
+#include "CollisionQueryParams.h"
 
 #include "GA_Vault.generated.h"
 
 class UAbilityTask_PlayMontageAndWait;
+class AActionGameCharacter;
+class UPrimitiveComponent;
+struct FTraversalVaultCandidate;
+
+// Collision settings shared by all the sweeps of a single vault check.
+struct FVaultTraceParams
+{
+	FCollisionQueryParams QueryParams;
+	FCollisionObjectQueryParams ObjectQueryParams;
+	bool bDrawDebug = false;
+};
 
 UCLASS()
 class ACTIONGAMERUNTIME_API UGA_Vault : public UAG_GameplayAbility
@@ -24,6 +36,16 @@ class ACTIONGAMERUNTIME_API UGA_Vault : public UAG_GameplayAbility
 
 protected:
 
+	// Full trace scan for a vault in front of the character. Sets JumpToLocation and JumpOverLocation on success.
+	// The horizontal column comes from the movement component's shared traces when available.
+	bool TraceVaultLocations(const AActionGameCharacter* Character, const FVaultTraceParams& TraceParams, bool& bOutOnlyStaticHits, UPrimitiveComponent*& OutVaultComponent, FVector& OutEdgeNormal);
+
+	// Checks a cached candidate with one trace down onto the edge and one across the top. Sets JumpToLocation and
+	// JumpOverLocation on success.
+	bool ConfirmVaultCandidate(const FTraversalVaultCandidate& Candidate, const FVaultTraceParams& TraceParams);
+
+	bool SweepForVault(const FVector& TraceStart, const FVector& TraceEnd, float Radius, const FVaultTraceParams& TraceParams, FHitResult& OutHit) const;
+
 	UPROPERTY(EditDefaultsOnly, Category = HorizontalTrace)
 	float HorizontalTraceRadius = 30.f;
 
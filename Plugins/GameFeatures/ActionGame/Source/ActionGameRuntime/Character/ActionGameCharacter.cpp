@@ -14,12 +14,14 @@
 
 #include "AbilitySystemComponent.h"
 #include "CommonMotionWarpingComponent.h"
+#include "RDCharacterMovementComponent2.h"
 #include "ActionGameRuntime/AbilitySystem/Components/AG_AbilitySystemComponentBase.h"
 //#include "GameplayEffectTypes.h"
 
 
 
 AActionGameCharacter::AActionGameCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<URDCharacterMovementComponent2>(ACharacter::CharacterMovementComponentName))
 {
 	// Set size for collision capsule
 	GetCapsuleComponent()->InitCapsuleSize(42.f, 96.0f);
@@ -74,8 +76,54 @@ void AActionGameCharacter::Landed(const FHitResult& Hit)
 
 	if (AbilitySystemComponent)
 	{
-		AbilitySystemComponent->RemoveActiveEffectsWithTags(InAirTags);
+		for (const FActiveGameplayEffectHandle& ActiveHandle : InAirEffectHandles)
+		{
+			AbilitySystemComponent->RemoveActiveGameplayEffect(ActiveHandle);
+		}
 	}
+
+	InAirEffectHandles.Reset();
+}
+
+void AActionGameCharacter::BindInAirEffectTracking()
+{
+	if (!AbilitySystemComponent || InAirEffectAddedHandle.IsValid())
+	{
+		return;
+	}
+
+	InAirEffectAddedHandle = AbilitySystemComponent->OnActiveGameplayEffectAddedDelegateToSelf.AddUObject(this, &AActionGameCharacter::OnActiveGameplayEffectAdded);
+}
+
+void AActionGameCharacter::OnActiveGameplayEffectAdded(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle ActiveHandle)
+{
+	if (InAirTags.IsEmpty())
+	{
+		return;
+	}
+
+	// Same tags RemoveActiveEffectsWithTags matched against: the effect's asset tags and the tags it grants.
+	FGameplayTagContainer OwnedTags;
+	Spec.GetAllAssetTags(OwnedTags);
+	Spec.GetAllGrantedTags(OwnedTags);
+
+	if (OwnedTags.HasAny(InAirTags))
+	{
+		InAirEffectHandles.Add(ActiveHandle);
+	}
+}
+
+void AActionGameCharacter::Jump()
+{
+	// Vault, mantle and climb all read the column the movement component traced this tick, so input costs no extra sweeps.
+	URDCharacterMovementComponent2* MovementComponent = Cast<URDCharacterMovementComponent2>(GetCharacterMovement());
+
+	if (MovementComponent && MovementComponent->TryTraversal(AbilitySystemComponent))
+	{
+		return;
+	}
+
+	Super::Jump();
 }
 
 UCommonMotionWarpingComponent* AActionGameCharacter::GetCommonMotionWarpingComponent() const
@@ -103,9 +151,13 @@ void AActionGameCharacter::GiveAbilities()
 void AActionGameCharacter::PossessedBy(AController* NewController)
 {
 	Super::PossessedBy(NewController);
+
+	BindInAirEffectTracking();
 }
 
 void AActionGameCharacter::OnRep_PlayerState()
 {
 	Super::OnRep_PlayerState();
+
+	BindInAirEffectTracking();
 }
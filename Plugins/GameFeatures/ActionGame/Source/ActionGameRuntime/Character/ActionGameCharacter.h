@@ -48,6 +48,9 @@ public:
 
 	
 	virtual void Landed(const FHitResult& Hit) override;
+
+	// Jump input tries the traversal abilities first and only jumps when none of them activates.
+	virtual void Jump() override;
 	
 	UCommonMotionWarpingComponent* GetCommonMotionWarpingComponent() const;
 
@@ -89,5 +92,14 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly)
 	FGameplayTagContainer InAirTags;
+
+	// Handles of active effects carrying InAirTags, so landing removes them directly instead of querying by tag.
+	TArray<FActiveGameplayEffectHandle> InAirEffectHandles;
+
+	FDelegateHandle InAirEffectAddedHandle;
+
+	void BindInAirEffectTracking();
+
+	void OnActiveGameplayEffectAdded(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle ActiveHandle);
 	
 };
\ No newline at end of file
@@ -3,57 +3,140 @@
 
 #include "CommonMotionWarpingComponent.h"
 
+#include "Net/UnrealNetwork.h"
+
+
+void FReplicatedWarpTarget::SetRotation(const FRotator& Rotation)
+{
+	Pitch = FRotator::CompressAxisToShort(Rotation.Pitch);
+	Yaw = FRotator::CompressAxisToShort(Rotation.Yaw);
+	Roll = FRotator::CompressAxisToShort(Rotation.Roll);
+}
+
+FRotator FReplicatedWarpTarget::GetRotation() const
+{
+	return FRotator(FRotator::DecompressAxisFromShort(Pitch), FRotator::DecompressAxisFromShort(Yaw), FRotator::DecompressAxisFromShort(Roll));
+}
+
+void FReplicatedWarpTarget::PreReplicatedRemove(const FReplicatedWarpTargetArray& InArraySerializer)
+{
+	// The owning client already removed the targets of its own predicted activations when they ended.
+	if (InArraySerializer.Owner && !InArraySerializer.Owner->WasLocallyPredicted(PredictionKey))
+	{
+		InArraySerializer.Owner->RemoveWarpTarget(InArraySerializer.Owner->GetReplicatedWarpTargetName(NameIndex));
+	}
+}
+
+void FReplicatedWarpTarget::PostReplicatedAdd(const FReplicatedWarpTargetArray& InArraySerializer)
+{
+	if (InArraySerializer.Owner && !InArraySerializer.Owner->WasLocallyPredicted(PredictionKey))
+	{
+		InArraySerializer.Owner->AddOrUpdateWarpTargetFromLocationAndRotation(InArraySerializer.Owner->GetReplicatedWarpTargetName(NameIndex), Location, GetRotation());
+	}
+}
+
+void FReplicatedWarpTarget::PostReplicatedChange(const FReplicatedWarpTargetArray& InArraySerializer)
+{
+	PostReplicatedAdd(InArraySerializer);
+}
 
 UCommonMotionWarpingComponent::UCommonMotionWarpingComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
+	, ReplicatedWarpTargets(this)
 {
 	//SetIsReplicated(true);
 	
 	// Can directly modify bReplicates,  without side effect.
 	SetIsReplicatedByDefault(true);
+
+	ReplicatedWarpTargetNames = {TEXT("JumpToLocation"), TEXT("JumpOverLocation")};
 }
 
-void UCommonMotionWarpingComponent::SendWarpPointsToClients()
+void UCommonMotionWarpingComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
-	if (GetOwnerRole() == ROLE_Authority)
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// Sent to the owner as well, so server-initiated traversals warp there too. The owner skips the targets of
+	// activations it predicted, see WasLocallyPredicted.
+	DOREPLIFETIME(UCommonMotionWarpingComponent, ReplicatedWarpTargets);
+}
+
+void UCommonMotionWarpingComponent::AddLocallyPredictedKey(FPredictionKey PredictionKey)
+{
+	if (!PredictionKey.IsValidKey())
 	{
-		// 5.0 Old version engine API.
-		// if (GetOwnerRole() == ROLE_Authority)
-		// {
-		// 	TArray<FMotionWarpingTargetByLocationAndRotation> WarpTargets;
-		//
-		// 	for (auto WarpTarget : WarpTargetMap)
-		// 	{
-		// 		FMotionWarpingTargetByLocationAndRotation MotionWarpingTarget(WarpTarget.Key, WarpTarget.Value.GetLocation(), WarpTarget.Value.GetRotation());
-		//
-		// 		WarpTargets.Add(MotionWarpingTarget);
-		// 	}
-		//
-		// 	MulticastSyncWarpPoints(WarpTargets);
-		// }
-
-		
-		// 5.1 New engine API, TMap change to TArray.
-		if (GetOwnerRole() == ROLE_Authority)
-		{
-			TArray<FMotionWarpingTargetByLocationAndRotation> WarpTargetArray;
-	
-			for (auto WarpTarget : WarpTargets)
-			{
-				FMotionWarpingTargetByLocationAndRotation MotionWarpingTarget(WarpTarget.Name, WarpTarget.Location, WarpTarget.Rotation.Quaternion());
-	
-				WarpTargetArray.Add(MotionWarpingTarget);
-			}
-	
-			MulticastSyncWarpPoints(WarpTargetArray);
-		}
+		return;
 	}
+
+	if (LocallyPredictedKeys.Num() == LocallyPredictedKeys.Max())
+	{
+		LocallyPredictedKeys.RemoveAt(0, 1, EAllowShrinking::No);
+	}
+
+	LocallyPredictedKeys.Add(PredictionKey.Current);
 }
 
-void UCommonMotionWarpingComponent::MulticastSyncWarpPoints_Implementation(const TArray<FMotionWarpingTargetByLocationAndRotation>& Targets)
+bool UCommonMotionWarpingComponent::WasLocallyPredicted(int16 PredictionKey) const
 {
-	for (const FMotionWarpingTargetByLocationAndRotation& Target : Targets)
+	return PredictionKey != 0 && LocallyPredictedKeys.Contains(PredictionKey);
+}
+
+FName UCommonMotionWarpingComponent::GetReplicatedWarpTargetName(uint8 NameIndex) const
+{
+	return ReplicatedWarpTargetNames.IsValidIndex(NameIndex) ? ReplicatedWarpTargetNames[NameIndex] : NAME_None;
+}
+
+void UCommonMotionWarpingComponent::SendWarpPointsToClients(FPredictionKey PredictionKey)
+{
+	if (GetOwnerRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	// 5.1 engine API, warp targets are kept in a TArray.
+	TArray<FReplicatedWarpTarget>& Items = ReplicatedWarpTargets.Items;
+
+	for (int32 i = Items.Num() - 1; i >= 0; --i)
+	{
+		const FName Name = GetReplicatedWarpTargetName(Items[i].NameIndex);
+
+		if (!WarpTargets.ContainsByPredicate([&Name](const FMotionWarpingTarget& WarpTarget) { return WarpTarget.Name == Name; }))
+		{
+			Items.RemoveAtSwap(i);
+			ReplicatedWarpTargets.MarkArrayDirty();
+		}
+	}
+
+	for (const FMotionWarpingTarget& WarpTarget : WarpTargets)
 	{
-		AddOrUpdateWarpTargetFromLocationAndRotation(Target.Name, Target.Location, FRotator(Target.Rotation));
+		const int32 NameIndex = ReplicatedWarpTargetNames.IndexOfByKey(WarpTarget.Name);
+
+		if (NameIndex == INDEX_NONE || NameIndex > MAX_uint8)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s: warp target %s is not in ReplicatedWarpTargetNames and won't be replicated."), *GetNameSafe(GetOwner()), *WarpTarget.Name.ToString());
+			continue;
+		}
+
+		FReplicatedWarpTarget NewItem;
+		NewItem.NameIndex = static_cast<uint8>(NameIndex);
+		NewItem.Location = WarpTarget.Location;
+		NewItem.SetRotation(WarpTarget.Rotation);
+		NewItem.PredictionKey = PredictionKey.Current;
+
+		FReplicatedWarpTarget* Item = Items.FindByPredicate([&NewItem](const FReplicatedWarpTarget& Existing) { return Existing.NameIndex == NewItem.NameIndex; });
+
+		if (!Item)
+		{
+			ReplicatedWarpTargets.MarkItemDirty(Items.Add_GetRef(NewItem));
+		}
+		else if (FVector(Item->Location) != FVector(NewItem.Location) || Item->Pitch != NewItem.Pitch || Item->Yaw != NewItem.Yaw || Item->Roll != NewItem.Roll || Item->PredictionKey != NewItem.PredictionKey)
+		{
+			Item->Location = NewItem.Location;
+			Item->Pitch = NewItem.Pitch;
+			Item->Yaw = NewItem.Yaw;
+			Item->Roll = NewItem.Roll;
+			Item->PredictionKey = NewItem.PredictionKey;
+			ReplicatedWarpTargets.MarkItemDirty(*Item);
+		}
 	}
 }
@@ -5,8 +5,84 @@
 #include "CoreMinimal.h"
 #include "MotionWarpingComponent.h"
 #include "ActionGameRuntime/ActionGameTypes.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "Engine/NetSerialization.h"
+#include "GameplayPrediction.h"
 #include "CommonMotionWarpingComponent.generated.h"
 
+class UCommonMotionWarpingComponent;
+struct FReplicatedWarpTargetArray;
+
+// Quantized warp target. The name is sent as an index into the component's ReplicatedWarpTargetNames.
+USTRUCT()
+struct FReplicatedWarpTarget : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint8 NameIndex = 0;
+
+	UPROPERTY()
+	FVector_NetQuantize10 Location;
+
+	UPROPERTY()
+	uint16 Pitch = 0;
+
+	UPROPERTY()
+	uint16 Yaw = 0;
+
+	UPROPERTY()
+	uint16 Roll = 0;
+
+	// Prediction key of the activation that set this target, 0 when the server initiated it.
+	UPROPERTY()
+	int16 PredictionKey = 0;
+
+	void SetRotation(const FRotator& Rotation);
+	FRotator GetRotation() const;
+
+	void PreReplicatedRemove(const FReplicatedWarpTargetArray& InArraySerializer);
+	void PostReplicatedAdd(const FReplicatedWarpTargetArray& InArraySerializer);
+	void PostReplicatedChange(const FReplicatedWarpTargetArray& InArraySerializer);
+};
+
+USTRUCT()
+struct FReplicatedWarpTargetArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	FReplicatedWarpTargetArray()
+	{
+
+	}
+
+	FReplicatedWarpTargetArray(UCommonMotionWarpingComponent* InOwner)
+		: Owner(InOwner)
+	{
+
+	}
+
+	UPROPERTY()
+	TArray<FReplicatedWarpTarget> Items;
+
+	UPROPERTY(NotReplicated)
+	UCommonMotionWarpingComponent* Owner = nullptr;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FReplicatedWarpTarget, FReplicatedWarpTargetArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FReplicatedWarpTargetArray> : public TStructOpsTypeTraitsBase2<FReplicatedWarpTargetArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
+
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class ACTIONGAMERUNTIME_API UCommonMotionWarpingComponent : public UMotionWarpingComponent
@@ -16,8 +92,28 @@ class ACTIONGAMERUNTIME_API UCommonMotionWarpingComponent : public UMotionWarpin
 public:
 	UCommonMotionWarpingComponent(const FObjectInitializer& ObjectInitializer);
 
-	void SendWarpPointsToClients();
+	// Pushes the current warp targets into the replicated array, tagged with the activation's prediction key. Only
+	// changed targets are sent.
+	void SendWarpPointsToClients(FPredictionKey PredictionKey = FPredictionKey());
+
+	// Called on the owning client when it predicts an activation and sets the warp targets itself. Replicated
+	// targets tagged with this key are then skipped, everything else (server-initiated activations) is applied.
+	void AddLocallyPredictedKey(FPredictionKey PredictionKey);
+	bool WasLocallyPredicted(int16 PredictionKey) const;
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	FName GetReplicatedWarpTargetName(uint8 NameIndex) const;
+
+protected:
+
+	// Warp target names that can be replicated. Targets are sent as an index into this list.
+	UPROPERTY(EditDefaultsOnly, Category = "Motion Warping")
+	TArray<FName> ReplicatedWarpTargetNames;
+
+	UPROPERTY(Replicated)
+	FReplicatedWarpTargetArray ReplicatedWarpTargets;
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastSyncWarpPoints(const TArray<FMotionWarpingTargetByLocationAndRotation>& Targets);
+	// Most recent prediction keys this client set warp targets for. Only a few activations can be in flight.
+	TArray<int16, TInlineAllocator<8>> LocallyPredictedKeys;
 };
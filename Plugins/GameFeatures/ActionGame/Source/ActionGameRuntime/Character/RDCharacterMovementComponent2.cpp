@@ -5,6 +5,8 @@
 #include "GameFramework/Character.h"
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
+#include "Abilities/GameplayAbility.h"
+#include "Engine/World.h"
 
 
 
@@ -56,7 +58,174 @@ void URDCharacterMovementComponent2::HandleMovementDirection()
 	}
 }
 
+void URDCharacterMovementComponent2::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	UpdateTraversalTraces();
+}
+
+void URDCharacterMovementComponent2::InitTraversalTraceResults(FTraversalTraceResults& Results, const FCollisionObjectQueryParams& ObjectQueryParams) const
+{
+	Results.StartLocation = CharacterOwner->GetActorLocation();
+	Results.ForwardVector = CharacterOwner->GetActorForwardVector();
+	Results.UpVector = CharacterOwner->GetActorUpVector();
+	Results.Radius = TraversalTraceRadius;
+	Results.Length = TraversalTraceLength;
+	Results.Step = TraversalTraceStep;
+	Results.ObjectQueryParams = ObjectQueryParams;
+	Results.bTraceComplex = true;
+	Results.IgnoredActor = CharacterOwner;
+	Results.FrameNumber = GFrameCounter;
+	Results.Hits.SetNum(TraversalTraceCount);
+}
+
+void URDCharacterMovementComponent2::UpdateTraversalTraces()
+{
+	UWorld* World = GetWorld();
+
+	if (!World)
+	{
+		return;
+	}
+
+	// Collect last tick's batch. Async traces are resolved at the end of the frame they were issued in.
+	if (PendingTraversalTraces.Num() > 0)
+	{
+		bool bAllReady = true;
+
+		for (int32 i = 0; i < PendingTraversalTraces.Num(); ++i)
+		{
+			FTraceDatum TraceDatum;
+
+			if (!World->QueryTraceData(PendingTraversalTraces[i], TraceDatum))
+			{
+				bAllReady = false;
+				break;
+			}
+
+			PendingTraversalTraceResults.Hits[i] = TraceDatum.OutHits.Num() > 0 ? TraceDatum.OutHits[0] : FHitResult();
+		}
+
+		if (bAllReady)
+		{
+			TraversalTraceResults = PendingTraversalTraceResults;
+		}
+
+		PendingTraversalTraces.Reset();
+	}
+
+	if (PendingTraversalGate.IsValid())
+	{
+		FOverlapDatum OverlapDatum;
+
+		if (World->QueryOverlapData(PendingTraversalGate, OverlapDatum))
+		{
+			bTraversalGeometryNearby = OverlapDatum.OutOverlaps.Num() > 0;
+
+			// Nothing around the column, so it would have missed everywhere. Publish that without sweeping it.
+			if (!bTraversalGeometryNearby)
+			{
+				TraversalTraceResults = PendingTraversalGateResults;
+			}
+		}
+
+		PendingTraversalGate.Invalidate();
+	}
+
+	const FCollisionObjectQueryParams ObjectQueryParams(TraversalTraceObjectTypes);
+
+	// Simulated proxies never run traversal abilities, so there is nothing to trace for. Without object types the
+	// sweeps can't hit anything, leave the abilities to trace with their own settings.
+	if (!CharacterOwner || CharacterOwner->GetLocalRole() == ROLE_SimulatedProxy || TraversalAbilitiesOrdered.Num() == 0 || TraversalTraceCount <= 0 || !ObjectQueryParams.IsValid())
+	{
+		bTraversalGeometryNearby = false;
+		return;
+	}
+
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(TraversalTrace), true, CharacterOwner);
+
+	InitTraversalTraceResults(PendingTraversalGateResults, ObjectQueryParams);
+
+	for (FHitResult& Hit : PendingTraversalGateResults.Hits)
+	{
+		Hit = FHitResult();
+	}
+
+	const float ColumnHeight = (TraversalTraceCount - 1) * TraversalTraceStep;
+	const FVector GateCenter = PendingTraversalGateResults.StartLocation + PendingTraversalGateResults.ForwardVector * TraversalTraceLength * 0.5f + PendingTraversalGateResults.UpVector * ColumnHeight * 0.5f;
+	const FVector GateExtent(TraversalTraceLength * 0.5f + TraversalTraceRadius + TraversalGateMargin, TraversalTraceRadius + TraversalGateMargin, ColumnHeight * 0.5f + TraversalTraceRadius + TraversalGateMargin);
+	const FQuat GateRotation = FRotationMatrix::MakeFromXZ(PendingTraversalGateResults.ForwardVector, PendingTraversalGateResults.UpVector).ToQuat();
+
+	PendingTraversalGate = World->AsyncOverlapByObjectType(GateCenter, GateRotation, ObjectQueryParams, FCollisionShape::MakeBox(GateExtent), QueryParams);
+
+	// The column is only worth sweeping while the last overlap found something to traverse.
+	if (!bTraversalGeometryNearby)
+	{
+		return;
+	}
+
+	const FCollisionShape Shape = FCollisionShape::MakeSphere(TraversalTraceRadius);
+
+	InitTraversalTraceResults(PendingTraversalTraceResults, ObjectQueryParams);
+
+	for (int32 i = 0; i < TraversalTraceCount; ++i)
+	{
+		const FVector TraceStart = PendingTraversalTraceResults.StartLocation + i * PendingTraversalTraceResults.UpVector * TraversalTraceStep;
+		const FVector TraceEnd = TraceStart + PendingTraversalTraceResults.ForwardVector * TraversalTraceLength;
+
+		PendingTraversalTraces.Add(World->AsyncSweepByObjectType(EAsyncTraceType::Single, TraceStart, TraceEnd, FQuat::Identity, ObjectQueryParams, Shape, QueryParams));
+	}
+}
+
+const FTraversalTraceResults* URDCharacterMovementComponent2::GetTraversalTraceResults() const
+{
+	if (!CharacterOwner || TraversalTraceResults.Hits.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	// Issued last tick, so anything older means traces stopped being issued.
+	if (GFrameCounter - TraversalTraceResults.FrameNumber > 2)
+	{
+		return nullptr;
+	}
+
+	if (FVector::DistSquared(CharacterOwner->GetActorLocation(), TraversalTraceResults.StartLocation) > FMath::Square(TraversalTraceReuseDistance))
+	{
+		return nullptr;
+	}
+
+	if ((CharacterOwner->GetActorForwardVector() | TraversalTraceResults.ForwardVector) < 0.99f)
+	{
+		return nullptr;
+	}
+
+	return &TraversalTraceResults;
+}
+
 bool URDCharacterMovementComponent2::TryTraversal(UAbilitySystemComponent* ASC)
 {
+	if (!ASC)
+	{
+		return false;
+	}
+
+	// Every ability checks against the same shared traces, so trying them in order costs no extra column traces.
+	for (const TSubclassOf<UGameplayAbility>& AbilityClass : TraversalAbilitiesOrdered)
+	{
+		if (!AbilityClass || !ASC->TryActivateAbilityByClass(AbilityClass, true))
+		{
+			continue;
+		}
+
+		const FGameplayAbilitySpec* Spec = ASC->FindAbilitySpecFromClass(AbilityClass);
+
+		if (Spec && Spec->IsActive())
+		{
+			return true;
+		}
+	}
+
 	return false;
-}
+}
\ No newline at end of file
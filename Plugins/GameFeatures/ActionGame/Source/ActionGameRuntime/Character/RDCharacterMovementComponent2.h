@@ -6,11 +6,43 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "ActionGameRuntime/ActionGameTypes.h"
 #include "GameplayTagContainer.h"
+#include "WorldCollision.h"
 #include "RDCharacterMovementComponent2.generated.h"
 
 class UAbilitySystemComponent;
 class UGameplayAbility;
 
+// Horizontal sweeps in front of the character, issued asynchronously once per movement tick and shared by all
+// traversal abilities so they don't each trace the same column on input.
+struct FTraversalTraceResults
+{
+	FVector StartLocation = FVector::ZeroVector;
+	FVector ForwardVector = FVector::ForwardVector;
+	FVector UpVector = FVector::UpVector;
+
+	float Radius = 0.f;
+	float Length = 0.f;
+	float Step = 0.f;
+
+	FCollisionObjectQueryParams ObjectQueryParams;
+	bool bTraceComplex = true;
+
+	// Always the character itself.
+	TWeakObjectPtr<const AActor> IgnoredActor;
+
+	// One entry per step up from StartLocation, bBlockingHit is false where nothing was hit.
+	TArray<FHitResult, TInlineAllocator<8>> Hits;
+
+	uint64 FrameNumber = 0;
+
+	// Whether these traces match the column an ability would trace itself, including what they collide with.
+	bool IsCompatible(float InRadius, float InLength, int32 InCount, float InStep, const FCollisionObjectQueryParams& InObjectQueryParams, bool bInTraceComplex, const AActor* InIgnoredActor) const
+	{
+		return Hits.Num() == InCount && FMath::IsNearlyEqual(Radius, InRadius) && FMath::IsNearlyEqual(Length, InLength) && FMath::IsNearlyEqual(Step, InStep)
+			&& ObjectQueryParams.GetQueryBitfield() == InObjectQueryParams.GetQueryBitfield() && bTraceComplex == bInTraceComplex && IgnoredActor.Get() == InIgnoredActor;
+	}
+};
+
 UCLASS()
 class ACTIONGAMERUNTIME_API URDCharacterMovementComponent2 : public UCharacterMovementComponent
 {
@@ -18,10 +50,17 @@ class ACTIONGAMERUNTIME_API URDCharacterMovementComponent2 : public UCharacterMo
 	
 public:
 
+	// Tries the traversal abilities in order against the shared traces and returns true once one of them activates.
+	UFUNCTION(BlueprintCallable)
 	bool TryTraversal(UAbilitySystemComponent* ASC);
 
+	// Latest traversal traces if they were taken close enough to where the character is now, otherwise null.
+	const FTraversalTraceResults* GetTraversalTraceResults() const;
+
 	virtual void BeginPlay() override;
 
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
 	virtual bool CanAttemptJump() const override;
 
 	UFUNCTION(BlueprintPure)
@@ -41,6 +80,47 @@ protected:
 	UPROPERTY(EditAnywhere)
 	EMovementDirectionType MovementDirectionType;
 
+	// Abilities reuse these traces only when their own horizontal trace settings and object types match.
+	UPROPERTY(EditDefaultsOnly, Category = Traversal)
+	float TraversalTraceRadius = 30.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = Traversal)
+	float TraversalTraceLength = 500.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = Traversal)
+	int32 TraversalTraceCount = 5;
+
+	UPROPERTY(EditDefaultsOnly, Category = Traversal)
+	float TraversalTraceStep = 30.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = Traversal)
+	TArray<TEnumAsByte<EObjectTypeQuery>> TraversalTraceObjectTypes;
+
+	// How far the character may have moved since the shared traces were issued for them to still be used.
+	UPROPERTY(EditDefaultsOnly, Category = Traversal)
+	float TraversalTraceReuseDistance = 25.f;
+
+	// Extra room around the column for the overlap that decides whether the column is worth sweeping at all.
+	UPROPERTY(EditDefaultsOnly, Category = Traversal)
+	float TraversalGateMargin = 50.f;
+
 	void HandleMovementDirection();
+
+	void UpdateTraversalTraces();
+
+	// Fills the location and settings of a column traced from where the character is now.
+	void InitTraversalTraceResults(FTraversalTraceResults& Results, const FCollisionObjectQueryParams& ObjectQueryParams) const;
+
+	FTraversalTraceResults TraversalTraceResults;
+
+	// Batch issued last tick, results are collected on the next one.
+	TArray<FTraceHandle, TInlineAllocator<8>> PendingTraversalTraces;
+	FTraversalTraceResults PendingTraversalTraceResults;
+
+	// One overlap around the column per tick. The column itself is only swept while it found traversal geometry,
+	// an empty overlap means every sweep would miss.
+	FTraceHandle PendingTraversalGate;
+	FTraversalTraceResults PendingTraversalGateResults;
+	bool bTraversalGeometryNearby = false;
 	
 };
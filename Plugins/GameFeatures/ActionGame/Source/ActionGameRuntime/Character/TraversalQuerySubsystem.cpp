@@ -0,0 +1,400 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "TraversalQuerySubsystem.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+
+static float TraversalCacheCellSize = 200.f;
+static FAutoConsoleVariableRef CVarTraversalCacheCellSize(
+	TEXT("ActionGame.Traversal.CacheCellSize"),
+	TraversalCacheCellSize,
+	TEXT("Size of the grid cells used to cache traversal edges."),
+	ECVF_Default);
+
+static float TraversalMissLifetime = 0.5f;
+static FAutoConsoleVariableRef CVarTraversalMissLifetime(
+	TEXT("ActionGame.Traversal.MissLifetime"),
+	TraversalMissLifetime,
+	TEXT("Seconds a failed traversal scan is remembered before the same location and facing is scanned again."),
+	ECVF_Default);
+
+static float TraversalMissTolerance = 5.f;
+static FAutoConsoleVariableRef CVarTraversalMissTolerance(
+	TEXT("ActionGame.Traversal.MissTolerance"),
+	TraversalMissTolerance,
+	TEXT("Distance the character may move before a remembered failed traversal scan no longer applies."),
+	ECVF_Default);
+
+static float TraversalEdgeTolerance = 10.f;
+static FAutoConsoleVariableRef CVarTraversalEdgeTolerance(
+	TEXT("ActionGame.Traversal.EdgeTolerance"),
+	TraversalEdgeTolerance,
+	TEXT("Distance within which a rescanned traversal edge replaces the cached one."),
+	ECVF_Default);
+
+static float TraversalEdgeLifetime = 60.f;
+static FAutoConsoleVariableRef CVarTraversalEdgeLifetime(
+	TEXT("ActionGame.Traversal.EdgeLifetime"),
+	TraversalEdgeLifetime,
+	TEXT("Seconds a cached traversal edge is kept."),
+	ECVF_Default);
+
+namespace TraversalQuery
+{
+	constexpr int32 MaxEdgesPerCell = 8;
+
+	// Edges aren't stretched further than this either way from where they were hit, which bounds the cells they fill.
+	constexpr float MaxEdgeHalfLength = 1000.f;
+
+	// Misses only apply when facing almost the same way, a different facing scans different geometry.
+	constexpr float MinFacingDot = 0.996f;
+
+	// About 45 degrees, the widest angle an edge is vaulted at and the forward cone it has to be in.
+	constexpr float MinApproachDot = 0.707f;
+
+	// Rescans of the same edge have almost the same normal.
+	constexpr float MinSameEdgeDot = 0.98f;
+}
+
+bool UTraversalQuerySubsystem::FindVaultCandidate(const UClass* QueryClass, const FVector& Location, const FVector& Direction, float CapsuleRadius, float MaxDistance, float MinHeight, float MaxHeight, FTraversalVaultCandidate& OutCandidate) const
+{
+	const FTraversalClassCache* ClassCache = ClassCaches.Find(QueryClass);
+
+	if (!ClassCache || ClassCache->Edges.Num() == 0)
+	{
+		return false;
+	}
+
+	const float Now = GetWorld()->GetTimeSeconds();
+	const FVector Forward = Direction.GetSafeNormal2D();
+
+	if (Forward.IsZero())
+	{
+		return false;
+	}
+
+	// Every cell the forward cone can reach, at the heights a vaultable top can be at.
+	const FIntVector MinCell = GetCellCoord(FVector(Location.X - MaxDistance, Location.Y - MaxDistance, Location.Z + MinHeight));
+	const FIntVector MaxCell = GetCellCoord(FVector(Location.X + MaxDistance, Location.Y + MaxDistance, Location.Z + MaxHeight));
+
+	TArray<int32, TInlineAllocator<32>> CheckedEdges;
+
+	float BestDistance = MaxDistance;
+	bool bFound = false;
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				const FTraversalCell* Cell = ClassCache->Cells.Find(FIntVector(X, Y, Z));
+
+				if (!Cell)
+				{
+					continue;
+				}
+
+				for (const int32 EdgeIndex : Cell->VaultEdges)
+				{
+					if (CheckedEdges.Contains(EdgeIndex))
+					{
+						continue;
+					}
+
+					CheckedEdges.Add(EdgeIndex);
+
+					const FTraversalVaultEdge& Edge = ClassCache->Edges[EdgeIndex];
+
+					if (!Edge.Component.IsValid() || (Now - Edge.FoundTime) > TraversalEdgeLifetime)
+					{
+						continue;
+					}
+
+					const float Height = Edge.Start.Z - Location.Z;
+
+					if (Height < MinHeight || Height > MaxHeight)
+					{
+						continue;
+					}
+
+					// Facing into the obstacle, not along or away from it.
+					const float ApproachDot = -(Forward | Edge.Normal);
+
+					if (ApproachDot < TraversalQuery::MinApproachDot)
+					{
+						continue;
+					}
+
+					// Where straight ahead crosses the edge's line, then the nearest point of the edge to that. The capsule
+					// reaches the edge as long as that point is within its radius of the line ahead.
+					const float DistanceAhead = ((Edge.Start - Location) | -Edge.Normal) / ApproachDot;
+
+					if (DistanceAhead <= 0.f)
+					{
+						continue;
+					}
+
+					const FVector Crossing = FVector(Location.X, Location.Y, Edge.Start.Z) + Forward * DistanceAhead;
+					const FVector EdgePoint = FMath::ClosestPointOnSegment(Crossing, Edge.Start, Edge.End);
+
+					if (FVector::DistSquared(EdgePoint, Crossing) > FMath::Square(CapsuleRadius))
+					{
+						continue;
+					}
+
+					const FVector ToEdgePoint = (EdgePoint - Location).GetSafeNormal2D();
+
+					if ((ToEdgePoint | Forward) < TraversalQuery::MinApproachDot)
+					{
+						continue;
+					}
+
+					// The full scan only looks MaxDistance ahead, so the whole top has to fit in that.
+					const float Distance = FVector::Dist2D(EdgePoint, Location);
+					const float DistanceAcross = Edge.Depth / ApproachDot;
+
+					if (Distance > BestDistance || Distance + DistanceAcross > MaxDistance)
+					{
+						continue;
+					}
+
+					BestDistance = Distance;
+					bFound = true;
+
+					OutCandidate.JumpToLocation = EdgePoint;
+					OutCandidate.JumpOverLocation = EdgePoint + Forward * DistanceAcross + FVector::UpVector * Edge.JumpOverHeight;
+					OutCandidate.Component = Edge.Component;
+				}
+			}
+		}
+	}
+
+	return bFound;
+}
+
+void UTraversalQuerySubsystem::AddVaultEdge(const UClass* QueryClass, const FVector& JumpToLocation, const FVector& JumpOverLocation, const FVector& ScanDirection, const FVector& EdgeNormal, UPrimitiveComponent* Component)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	const float Now = GetWorld()->GetTimeSeconds();
+	PruneCells(Now);
+
+	FTraversalVaultEdge NewEdge;
+	NewEdge.Normal = EdgeNormal.GetSafeNormal2D();
+
+	if (NewEdge.Normal.IsZero())
+	{
+		NewEdge.Normal = -ScanDirection.GetSafeNormal2D();
+	}
+
+	const FVector Across = JumpOverLocation - JumpToLocation;
+	NewEdge.Depth = FMath::Max(Across | -NewEdge.Normal, 0.f);
+	NewEdge.JumpOverHeight = Across.Z;
+	NewEdge.Component = Component;
+	NewEdge.FoundTime = Now;
+
+	// Stretch the edge along the hit surface until it leaves the obstacle's bounds. The confirming trace catches
+	// stretches where the top isn't actually there or at a different height.
+	const FVector Along = FVector::CrossProduct(FVector::UpVector, NewEdge.Normal);
+	const FBox Bounds = Component->Bounds.GetBox();
+
+	float MinAlong = -TraversalQuery::MaxEdgeHalfLength;
+	float MaxAlong = TraversalQuery::MaxEdgeHalfLength;
+
+	for (int32 Axis = 0; Axis < 2; ++Axis)
+	{
+		if (FMath::Abs(Along[Axis]) < KINDA_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		const float T0 = (Bounds.Min[Axis] - JumpToLocation[Axis]) / Along[Axis];
+		const float T1 = (Bounds.Max[Axis] - JumpToLocation[Axis]) / Along[Axis];
+
+		MinAlong = FMath::Max(MinAlong, FMath::Min(T0, T1));
+		MaxAlong = FMath::Min(MaxAlong, FMath::Max(T0, T1));
+	}
+
+	NewEdge.Start = JumpToLocation + Along * FMath::Min(MinAlong, 0.f);
+	NewEdge.End = JumpToLocation + Along * FMath::Max(MaxAlong, 0.f);
+
+	FTraversalClassCache& ClassCache = ClassCaches.FindOrAdd(QueryClass);
+
+	// A rescan of an edge already cached replaces it.
+	if (const FTraversalCell* Cell = ClassCache.Cells.Find(GetCellCoord(JumpToLocation)))
+	{
+		const TArray<int32> CellEdges = Cell->VaultEdges;
+
+		for (const int32 EdgeIndex : CellEdges)
+		{
+			const FTraversalVaultEdge& Existing = ClassCache.Edges[EdgeIndex];
+
+			if (Existing.Component == NewEdge.Component
+				&& (Existing.Normal | NewEdge.Normal) >= TraversalQuery::MinSameEdgeDot
+				&& FMath::Abs(Existing.Start.Z - JumpToLocation.Z) <= TraversalEdgeTolerance
+				&& FMath::PointDistToLine(JumpToLocation, FVector::CrossProduct(FVector::UpVector, Existing.Normal), Existing.Start) <= TraversalEdgeTolerance)
+			{
+				RemoveEdge(ClassCache, EdgeIndex);
+			}
+		}
+	}
+
+	GetEdgeCells(NewEdge.Start, NewEdge.End, NewEdge.Cells);
+
+	const int32 NewIndex = ClassCache.Edges.Add(NewEdge);
+
+	for (const FIntVector& CellCoord : NewEdge.Cells)
+	{
+		FTraversalCell& Cell = ClassCache.Cells.FindOrAdd(CellCoord);
+
+		// Evict the oldest edge in a full cell, from every cell it is listed in.
+		while (Cell.VaultEdges.Num() >= TraversalQuery::MaxEdgesPerCell)
+		{
+			int32 OldestIndex = Cell.VaultEdges[0];
+
+			for (const int32 EdgeIndex : Cell.VaultEdges)
+			{
+				if (ClassCache.Edges[EdgeIndex].FoundTime < ClassCache.Edges[OldestIndex].FoundTime)
+				{
+					OldestIndex = EdgeIndex;
+				}
+			}
+
+			RemoveEdge(ClassCache, OldestIndex);
+		}
+
+		Cell.VaultEdges.Add(NewIndex);
+	}
+}
+
+void UTraversalQuerySubsystem::AddVaultMiss(const UClass* QueryClass, const FVector& Location, const FVector& Direction)
+{
+	const float Now = GetWorld()->GetTimeSeconds();
+	PruneCells(Now);
+
+	FTraversalCell& Cell = ClassCaches.FindOrAdd(QueryClass).Cells.FindOrAdd(GetCellCoord(Location));
+
+	Cell.VaultMisses.RemoveAll([Now](const FTraversalVaultMiss& Miss)
+	{
+		return (Now - Miss.MissTime) >= TraversalMissLifetime;
+	});
+
+	FTraversalVaultMiss& Miss = Cell.VaultMisses.AddDefaulted_GetRef();
+	Miss.ScanLocation = Location;
+	Miss.ScanDirection = Direction.GetSafeNormal2D();
+	Miss.MissTime = Now;
+}
+
+bool UTraversalQuerySubsystem::HasRecentVaultMiss(const UClass* QueryClass, const FVector& Location, const FVector& Direction) const
+{
+	const FTraversalClassCache* ClassCache = ClassCaches.Find(QueryClass);
+	const FTraversalCell* Cell = ClassCache ? ClassCache->Cells.Find(GetCellCoord(Location)) : nullptr;
+
+	if (!Cell)
+	{
+		return false;
+	}
+
+	const float Now = GetWorld()->GetTimeSeconds();
+	const FVector Forward = Direction.GetSafeNormal2D();
+
+	return Cell->VaultMisses.ContainsByPredicate([&](const FTraversalVaultMiss& Miss)
+	{
+		return (Now - Miss.MissTime) < TraversalMissLifetime
+			&& (Miss.ScanDirection | Forward) >= TraversalQuery::MinFacingDot
+			&& FVector::Dist(Miss.ScanLocation, Location) <= TraversalMissTolerance;
+	});
+}
+
+void UTraversalQuerySubsystem::Deinitialize()
+{
+	ClassCaches.Empty();
+
+	Super::Deinitialize();
+}
+
+FIntVector UTraversalQuerySubsystem::GetCellCoord(const FVector& Location) const
+{
+	const float CellSize = FMath::Max(TraversalCacheCellSize, 1.f);
+
+	return FIntVector(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize),
+		FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void UTraversalQuerySubsystem::GetEdgeCells(const FVector& Start, const FVector& End, TArray<FIntVector, TInlineAllocator<4>>& OutCells) const
+{
+	// Half-cell steps along the segment can't skip a cell it passes through by more than a corner.
+	const float CellSize = FMath::Max(TraversalCacheCellSize, 1.f);
+	const int32 StepCount = FMath::Max(FMath::CeilToInt(FVector::Dist(Start, End) / (CellSize * 0.5f)), 1);
+
+	for (int32 i = 0; i <= StepCount; ++i)
+	{
+		OutCells.AddUnique(GetCellCoord(FMath::Lerp(Start, End, static_cast<float>(i) / StepCount)));
+	}
+}
+
+void UTraversalQuerySubsystem::RemoveEdge(FTraversalClassCache& ClassCache, int32 EdgeIndex)
+{
+	// Empty cells are left for PruneCells, so references to other cells stay valid.
+	for (const FIntVector& CellCoord : ClassCache.Edges[EdgeIndex].Cells)
+	{
+		if (FTraversalCell* Cell = ClassCache.Cells.Find(CellCoord))
+		{
+			Cell->VaultEdges.RemoveSingleSwap(EdgeIndex);
+		}
+	}
+
+	ClassCache.Edges.RemoveAt(EdgeIndex);
+}
+
+void UTraversalQuerySubsystem::PruneCells(float Now)
+{
+	// Sweeping every cell is only worth it once entries can have expired.
+	if ((Now - LastPruneTime) < TraversalEdgeLifetime)
+	{
+		return;
+	}
+
+	LastPruneTime = Now;
+
+	for (auto ClassIt = ClassCaches.CreateIterator(); ClassIt; ++ClassIt)
+	{
+		FTraversalClassCache& ClassCache = ClassIt.Value();
+
+		for (auto EdgeIt = ClassCache.Edges.CreateIterator(); EdgeIt; ++EdgeIt)
+		{
+			if (!EdgeIt->Component.IsValid() || (Now - EdgeIt->FoundTime) > TraversalEdgeLifetime)
+			{
+				RemoveEdge(ClassCache, EdgeIt.GetIndex());
+			}
+		}
+
+		for (auto CellIt = ClassCache.Cells.CreateIterator(); CellIt; ++CellIt)
+		{
+			FTraversalCell& Cell = CellIt.Value();
+
+			Cell.VaultMisses.RemoveAll([Now](const FTraversalVaultMiss& Miss)
+			{
+				return (Now - Miss.MissTime) >= TraversalMissLifetime;
+			});
+
+			if (Cell.VaultEdges.Num() == 0 && Cell.VaultMisses.Num() == 0)
+			{
+				CellIt.RemoveCurrent();
+			}
+		}
+
+		if (ClassCache.Cells.Num() == 0)
+		{
+			ClassIt.RemoveCurrent();
+		}
+	}
+}
\ No newline at end of file
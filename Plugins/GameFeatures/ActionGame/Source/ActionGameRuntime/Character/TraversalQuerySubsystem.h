@@ -0,0 +1,108 @@
+﻿// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TraversalQuerySubsystem.generated.h"
+
+class UPrimitiveComponent;
+
+// A vaultable top edge of static geometry, found by a full trace scan and stretched along the obstacle's bounds.
+struct FTraversalVaultEdge
+{
+	// Ends of the near top edge, both at the height of the top.
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+
+	// Horizontal, pointing out of the obstacle towards the side it is vaulted from.
+	FVector Normal = FVector::BackwardVector;
+
+	// Distance across the top, perpendicular to the edge, and how far the far side sits above or below the near one.
+	float Depth = 0.f;
+	float JumpOverHeight = 0.f;
+
+	// The obstacle being vaulted, used to confirm the edge with a single trace.
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+
+	// World time the scan was made, edges age out after a while.
+	float FoundTime = 0.f;
+
+	// Cells the segment passes through, the edge is listed in each of them.
+	TArray<FIntVector, TInlineAllocator<4>> Cells;
+};
+
+// Where to vault over a cached edge from the character's current location, still to be confirmed with a trace.
+struct FTraversalVaultCandidate
+{
+	FVector JumpToLocation = FVector::ZeroVector;
+	FVector JumpOverLocation = FVector::ZeroVector;
+
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+};
+
+// A full trace scan that found nothing.
+struct FTraversalVaultMiss
+{
+	FVector ScanLocation = FVector::ZeroVector;
+	FVector ScanDirection = FVector::ForwardVector;
+	float MissTime = 0.f;
+};
+
+// Caches traversal trace results per grid cell, so repeated traversal checks against the same static geometry
+// become a nearest-edge lookup instead of a full trace scan. Filled lazily by the traversal abilities.
+UCLASS()
+class ACTIONGAMERUNTIME_API UTraversalQuerySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// Finds the nearest cached edge the character's capsule reaches within its forward cone, at most MaxDistance ahead
+	// and with a top between MinHeight and MaxHeight above Location. The candidate lines up with Direction.
+	bool FindVaultCandidate(const UClass* QueryClass, const FVector& Location, const FVector& Direction, float CapsuleRadius, float MaxDistance, float MinHeight, float MaxHeight, FTraversalVaultCandidate& OutCandidate) const;
+
+	// Caches the edge behind a successful scan. The edge runs across the scan direction, along the surface that was
+	// hit, as far as the obstacle's bounds go. Replaces a cached edge on the same line, evicts the oldest when a cell is full.
+	void AddVaultEdge(const UClass* QueryClass, const FVector& JumpToLocation, const FVector& JumpOverLocation, const FVector& ScanDirection, const FVector& EdgeNormal, UPrimitiveComponent* Component);
+
+	// Remembers that a full scan from this exact location and facing found nothing, so spamming the input doesn't rescan
+	// every time. Moving or turning even slightly scans again.
+	void AddVaultMiss(const UClass* QueryClass, const FVector& Location, const FVector& Direction);
+
+	bool HasRecentVaultMiss(const UClass* QueryClass, const FVector& Location, const FVector& Direction) const;
+
+	virtual void Deinitialize() override;
+
+protected:
+
+	struct FTraversalCell
+	{
+		// Indices into the class cache's edges, an edge is listed in every cell its segment passes through.
+		TArray<int32> VaultEdges;
+
+		TArray<FTraversalVaultMiss> VaultMisses;
+	};
+
+	struct FTraversalClassCache
+	{
+		TSparseArray<FTraversalVaultEdge> Edges;
+
+		TMap<FIntVector, FTraversalCell> Cells;
+	};
+
+	// Kept separately per querying ability class, since trace settings differ between abilities.
+	TMap<const UClass*, FTraversalClassCache> ClassCaches;
+
+	// World time expired entries and empty cells were last removed.
+	float LastPruneTime = 0.f;
+
+	FIntVector GetCellCoord(const FVector& Location) const;
+
+	// Cells the edge's segment passes through.
+	void GetEdgeCells(const FVector& Start, const FVector& End, TArray<FIntVector, TInlineAllocator<4>>& OutCells) const;
+
+	void RemoveEdge(FTraversalClassCache& ClassCache, int32 EdgeIndex);
+
+	void PruneCells(float Now);
+};
@@ -18,8 +18,10 @@ UAcousticsDynamicOpening::UAcousticsDynamicOpening(const class FObjectInitialize
     : Super(ObjectInitializer)
 {
     // Component state
-    PrimaryComponentTick.bCanEverTick = true;
-    PrimaryComponentTick.SetTickFunctionEnable(true);
+    // Openings don't tick. Attenuation changes are pushed through the setters and flushed
+    // in a single batch by the acoustics space each frame.
+    PrimaryComponentTick.bCanEverTick = false;
+    PrimaryComponentTick.bStartWithTickEnabled = false;
     bTickInEditor = false;
     bWantsOnUpdateTransform = true;
 
@@ -150,15 +152,37 @@ void UAcousticsDynamicOpening::OnUpdateTransform(EUpdateTransformFlags UpdateTra
     FlattenZ();
 }
 
-void UAcousticsDynamicOpening::TickComponent(
-    float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+void UAcousticsDynamicOpening::SetDryAttenuationDb(float NewDryAttenuationDb)
 {
-    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+    SetAttenuationDb(NewDryAttenuationDb, WetAttenuationDb);
+}
+
+void UAcousticsDynamicOpening::SetWetAttenuationDb(float NewWetAttenuationDb)
+{
+    SetAttenuationDb(DryAttenuationDb, NewWetAttenuationDb);
+}
+
+void UAcousticsDynamicOpening::SetAttenuationDb(float NewDryAttenuationDb, float NewWetAttenuationDb)
+{
+    NewDryAttenuationDb = FMath::Clamp(NewDryAttenuationDb, -120.0f, 0.0f);
+    NewWetAttenuationDb = FMath::Clamp(NewWetAttenuationDb, -120.0f, 0.0f);
+    if (NewDryAttenuationDb == DryAttenuationDb && NewWetAttenuationDb == WetAttenuationDb)
+    {
+        return;
+    }
+
+    DryAttenuationDb = NewDryAttenuationDb;
+    WetAttenuationDb = NewWetAttenuationDb;
+    MarkAttenuationDirty();
+}
 
+void UAcousticsDynamicOpening::MarkAttenuationDirty()
+{
+    // Before BeginPlay there is nothing registered yet. The current values are sent on registration.
     auto* world = GetWorld();
     if (world && world->IsGameWorld() && m_Acoustics && Vertices.Num() > 0)
     {
-        m_Acoustics->UpdateDynamicOpening(this, DryAttenuationDb, WetAttenuationDb);
+        m_Acoustics->QueueDynamicOpeningUpdate(this, DryAttenuationDb, WetAttenuationDb);
     }
 }
 
@@ -173,6 +197,12 @@ void UAcousticsDynamicOpening::PostEditChangeProperty(struct FPropertyChangedEve
         return;
     }
 
+    // Attenuation edited from the details panel while playing in editor
+    if (world->IsGameWorld())
+    {
+        MarkAttenuationDirty();
+    }
+
     if (world->IsEditorWorld())
     {
         if (e.MemberProperty != nullptr)
@@ -0,0 +1,87 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "AcousticsQueryRateController.h"
+
+// How often the rate allocation is recomputed
+constexpr double c_RateUpdateIntervalSeconds = 0.1;
+// Fraction of the workers' time we plan to use. Leaves headroom for spikes in query cost
+constexpr float c_TargetWorkerUtilization = 0.75f;
+// Smoothing factor for the moving averages. Higher reacts faster
+constexpr double c_AverageSmoothing = 0.2;
+// Starting guess for the cost of a query, until real measurements come in
+constexpr double c_InitialQueryTimeSeconds = 0.0005;
+// Even silent sources keep a small share, so they still reach the max rate when there is spare capacity
+constexpr float c_MinPriority = 0.01f;
+
+FAcousticsQueryRateController::FAcousticsQueryRateController(int32 numWorkers)
+    : m_NumWorkers(FMath::Max(numWorkers, 1))
+    , m_MinRate(2.0f)
+    , m_MaxRate(60.0f)
+    , m_AvgQueryTime(c_InitialQueryTimeSeconds)
+    , m_AvgAudioFrameTime(0)
+    , m_LastAudioFrameTime(0)
+    , m_LastUpdateTime(0)
+    , m_RatePerPriority(TNumericLimits<float>::Max())
+{
+}
+
+void FAcousticsQueryRateController::SetRateLimits(float minRate, float maxRate)
+{
+    m_MinRate = FMath::Max(minRate, 0.1f);
+    m_MaxRate = FMath::Max(maxRate, m_MinRate);
+}
+
+void FAcousticsQueryRateController::ReportQueryTime(double seconds)
+{
+    m_PendingQueryMicroseconds.Add(static_cast<int64>(seconds * 1000000.0));
+    m_PendingQueryCount.Increment();
+}
+
+void FAcousticsQueryRateController::OnAudioFrame(double nowSeconds)
+{
+    if (m_LastAudioFrameTime > 0)
+    {
+        const double frameTime = nowSeconds - m_LastAudioFrameTime;
+        m_AvgAudioFrameTime = m_AvgAudioFrameTime > 0
+                                  ? FMath::Lerp(m_AvgAudioFrameTime, frameTime, c_AverageSmoothing)
+                                  : frameTime;
+    }
+    m_LastAudioFrameTime = nowSeconds;
+}
+
+bool FAcousticsQueryRateController::NeedsUpdate(double nowSeconds) const
+{
+    return nowSeconds - m_LastUpdateTime >= c_RateUpdateIntervalSeconds;
+}
+
+void FAcousticsQueryRateController::Update(double nowSeconds, float totalPriority)
+{
+    m_LastUpdateTime = nowSeconds;
+
+    const int32 queryCount = m_PendingQueryCount.Set(0);
+    const int64 queryMicroseconds = m_PendingQueryMicroseconds.Set(0);
+    if (queryCount > 0)
+    {
+        const double queryTime = (queryMicroseconds / 1000000.0) / queryCount;
+        m_AvgQueryTime = FMath::Lerp(m_AvgQueryTime, queryTime, c_AverageSmoothing);
+    }
+
+    // Split what the workers can sustain across all sources, weighted by priority
+    const double capacity = c_TargetWorkerUtilization * m_NumWorkers / FMath::Max(m_AvgQueryTime, 1e-6);
+    m_RatePerPriority = totalPriority > KINDA_SMALL_NUMBER ? static_cast<float>(capacity / totalPriority)
+                                                           : TNumericLimits<float>::Max();
+}
+
+float FAcousticsQueryRateController::GetQueryRate(float priority) const
+{
+    // There is no benefit in querying a source more often than the audio renderer picks up results
+    float maxRate = m_MaxRate;
+    if (m_AvgAudioFrameTime > 0)
+    {
+        maxRate = FMath::Max(FMath::Min(maxRate, static_cast<float>(1.0 / m_AvgAudioFrameTime)), m_MinRate);
+    }
+
+    const float rate = FMath::Clamp(priority, c_MinPriority, 1.0f) * m_RatePerPriority;
+    return FMath::Clamp(rate, m_MinRate, maxRate);
+}
@@ -0,0 +1,55 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "HAL/ThreadSafeCounter64.h"
+
+// Decides how often acoustic queries are scheduled for each sound source.
+// Measures how long background queries take and how often the audio renderer updates, and splits
+// the query worker's capacity across sources proportionally to their priority. When there is spare
+// capacity every source runs at the max rate. Under heavy load, quiet and distant sources are
+// lowered towards the min rate first while loud, nearby sources keep updating quickly.
+class FAcousticsQueryRateController
+{
+public:
+    FAcousticsQueryRateController(int32 numWorkers);
+
+    // Min/max number of queries per second for any one source
+    void SetRateLimits(float minRate, float maxRate);
+
+    // Called from a query worker with the time a background query took. Thread safe
+    void ReportQueryTime(double seconds);
+
+    // Called once per audio frame, after all sources have been processed
+    void OnAudioFrame(double nowSeconds);
+
+    // Whether the rate allocation is due for an update. Caller should then call Update with
+    // the summed priority of all active sources
+    bool NeedsUpdate(double nowSeconds) const;
+    void Update(double nowSeconds, float totalPriority);
+
+    // Number of queries per second a source with the given priority should get
+    float GetQueryRate(float priority) const;
+
+private:
+    const int32 m_NumWorkers;
+    float m_MinRate;
+    float m_MaxRate;
+
+    // Smoothed average of how long one background query takes
+    double m_AvgQueryTime;
+    // Smoothed average time between audio frames. 0 until the audio renderer reports frames
+    double m_AvgAudioFrameTime;
+    double m_LastAudioFrameTime;
+    double m_LastUpdateTime;
+
+    // Queries per second available per unit of priority
+    float m_RatePerPriority;
+
+    // Accumulated by the query workers between updates
+    FThreadSafeCounter64 m_PendingQueryMicroseconds;
+    FThreadSafeCounter m_PendingQueryCount;
+};
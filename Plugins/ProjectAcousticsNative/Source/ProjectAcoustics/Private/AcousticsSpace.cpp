@@ -41,6 +41,7 @@ AAcousticsSpace::AAcousticsSpace(const class FObjectInitializer& ObjectInitializ
     CacheScale = 1.0f;
 
     m_Acoustics = nullptr;
+    m_IsAcousticsReady = false;
 
     // Debug controls
     AcousticsEnabled = true;
@@ -66,20 +67,17 @@ void AAcousticsSpace::BeginPlay()
 
         m_LastSpaceTransform = GetActorTransform();
         m_Acoustics->SetSpaceTransform(m_LastSpaceTransform);
+        m_Acoustics->SetGlobalDesign(GlobalDesignParams);
+        // Publish the initial frame state so anything registered before our first tick sees the space transform
+        m_Acoustics->PostTick();
 
 #if !UE_BUILD_SHIPPING
         // Update with current enabled state
         m_Acoustics->SetEnabled(AcousticsEnabled);
 #endif
 
-        auto success = LoadAcousticsData(AcousticsData);
-
-        if (success && AutoStream)
-        {
-            // Stream in the first tile if AutoLoad is enabled
-            auto listenerPosition = GetListenerPosition();
-            m_Acoustics->UpdateLoadedRegion(listenerPosition, TileSize, true, true, false);
-        }
+        // Loads in the background, the first tile is streamed in as part of the load if AutoStream is enabled
+        LoadAcousticsData(AcousticsData);
     }
 
 #if !UE_BUILD_SHIPPING
@@ -105,6 +103,28 @@ void AAcousticsSpace::BeginPlay()
 #endif //! UE_BUILD_SHIPPING
 }
 
+// Get locations of all local listeners. Split-screen players and replay spectators each have their
+// own local player controller.
+void AAcousticsSpace::GetListenerPositions(TArray<FVector>& outPositions)
+{
+    outPositions.Reset();
+    for (auto it = GetWorld()->GetPlayerControllerIterator(); it; ++it)
+    {
+        APlayerController* pc = it->Get();
+        if (pc != nullptr && pc->IsLocalController())
+        {
+            FVector Location, Front, Right;
+            pc->GetAudioListenerPosition(Location, Front, Right);
+            outPositions.Add(Location);
+        }
+    }
+
+    if (outPositions.Num() == 0)
+    {
+        outPositions.Add(FVector::ZeroVector);
+    }
+}
+
 // Get location of first listener
 FVector AAcousticsSpace::GetListenerPosition()
 {
@@ -137,6 +157,9 @@ void AAcousticsSpace::Tick(float deltaSeconds)
         m_Acoustics->SetGlobalDesign(GlobalDesignParams);
     }
 
+    // Push any dynamic opening changes made this frame in one batch
+    m_Acoustics->UpdateDynamicOpenings();
+
     // Update things dependent only on listener
     if (GetWorld()->IsGameWorld())
     {
@@ -147,27 +170,26 @@ void AAcousticsSpace::Tick(float deltaSeconds)
             m_LastSpaceTransform = currentTx;
         }
 
-        auto listenerPosition = GetListenerPosition();
+        GetListenerPositions(m_ListenerPositions);
 
-        // Update streaming
+        // Update streaming. Nearby listeners share loaded tiles
         if (AutoStream)
         {
-            m_Acoustics->UpdateLoadedRegion(listenerPosition, TileSize, false, true, false);
+            m_Acoustics->UpdateLoadedRegions(m_ListenerPositions, TileSize);
         }
 
-        // If there are active emitters in the scene, they will
-        // update outdoorness each frame automatically. But if there are
-        // no active emitters this frame, we hand-crank outdoorness.
-        m_Acoustics->UpdateOutdoorness(listenerPosition);
+        // Outdoorness only depends on the listeners, so it is computed here once per frame
+        // and handed to all sources through the frame state published in PostTick.
+        m_Acoustics->UpdateOutdoorness(m_ListenerPositions);
 
         // Update distances
         if (UpdateDistances)
         {
-            m_Acoustics->UpdateDistances(listenerPosition);
+            m_Acoustics->UpdateDistances(m_ListenerPositions);
         }
     }
 
-    // Inform processing for this frame is complete, updates internal per-frame state
+    // Inform processing for this frame is complete, publishes the per-frame state used by acoustic queries
     m_Acoustics->PostTick();
 }
 
@@ -211,6 +233,7 @@ void AAcousticsSpace::ForceLoadTile(FVector centerPosition, bool unloadProbesOut
 bool AAcousticsSpace::LoadAcousticsData(UAcousticsData* newData)
 {
     AcousticsData = newData;
+    m_IsAcousticsReady = false;
     if (newData == nullptr)
     {
         if (m_Acoustics)
@@ -230,16 +253,20 @@ bool AAcousticsSpace::LoadAceFile(FString filePath)
         return false;
     }
 
-    auto success = m_Acoustics->LoadAceFile(filePath, CacheScale);
-    if (success)
-    {
-        if (AutoStream)
+    // With AutoStream, the tile around the player start is made resident on the loading thread, so gameplay can
+    // start with acoustics in place around the player while the rest streams in on demand
+    const auto firstTileSize = AutoStream ? TileSize : FVector::ZeroVector;
+    TWeakObjectPtr<AAcousticsSpace> weakThis(this);
+    auto started = m_Acoustics->LoadAceFileAsync(
+        filePath, CacheScale, GetListenerPosition(), firstTileSize,
+        [weakThis, filePath](bool success)
         {
-            auto listenerPosition = GetListenerPosition();
-            m_Acoustics->UpdateLoadedRegion(listenerPosition, TileSize, true, true, false);
-        }
-    }
-    else
+            if (weakThis.IsValid())
+            {
+                weakThis->OnAceFileLoaded(success, filePath);
+            }
+        });
+    if (!started)
     {
         UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to load ACE file [%s]"), *filePath);
         return false;
@@ -248,7 +275,24 @@ bool AAcousticsSpace::LoadAceFile(FString filePath)
     return true;
 }
 
-bool AAcousticsSpace::QueryDistance(const FVector lookDirection, float& distance)
+void AAcousticsSpace::OnAceFileLoaded(bool success, FString filePath)
+{
+    if (!success)
+    {
+        UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to load ACE file [%s]"), *filePath);
+        return;
+    }
+
+    m_IsAcousticsReady = true;
+    OnAcousticsReady.Broadcast();
+}
+
+bool AAcousticsSpace::IsAcousticsReady() const
+{
+    return m_IsAcousticsReady;
+}
+
+bool AAcousticsSpace::QueryDistance(const FVector lookDirection, float& distance, int32 listenerIndex)
 {
     if (!m_Acoustics)
     {
@@ -256,10 +300,10 @@ bool AAcousticsSpace::QueryDistance(const FVector lookDirection, float& distance
         return false;
     }
 
-    return m_Acoustics->QueryDistance(lookDirection, distance);
+    return m_Acoustics->QueryDistance(lookDirection, distance, listenerIndex);
 }
 
-bool AAcousticsSpace::GetOutdoorness(float& outdoorness)
+bool AAcousticsSpace::GetOutdoorness(float& outdoorness, int32 listenerIndex)
 {
     if (!m_Acoustics)
     {
@@ -267,7 +311,7 @@ bool AAcousticsSpace::GetOutdoorness(float& outdoorness)
         return false;
     }
 
-    outdoorness = m_Acoustics->GetOutdoorness();
+    outdoorness = m_Acoustics->GetOutdoorness(listenerIndex);
     return true;
 }
 
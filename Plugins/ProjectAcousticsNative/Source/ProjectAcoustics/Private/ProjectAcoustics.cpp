@@ -47,22 +47,30 @@ constexpr bool c_UseTritonDebugInterface = true;
 constexpr bool c_UseTritonDebugInterface = false;
 #endif
 
+// Number of threads running background acoustic queries
+constexpr int32 c_NumQueryThreads = 1;
+
+// Listeners that moved less than this (in Triton units) keep their distances from the last update
+constexpr float c_DistanceListenerMoveTolerance = 0.01f;
+
 FProjectAcousticsModule::FProjectAcousticsModule()
     : m_Triton(nullptr)
     , m_AceFileLoaded(false)
     , m_LastLoadCenterPosition(0, 0, 0)
     , m_LastLoadTileSize(0, 0, 0)
     , m_IsOutdoornessStale(true)
-    , m_CachedOutdoorness(0)
-    , m_GlobalDesign(FAcousticsDesignParams::Default())
+    , m_IsAceFileLoading(false)
+    , m_AceLoadRequestId(0)
+    , m_FrameState(MakeShared<AcousticsFrameState, ESPMode::ThreadSafe>())
     , m_NumRunningTasks(0)
+    , m_QueryRateController(c_NumQueryThreads)
 {
 #if !UE_BUILD_SHIPPING
     m_IsEnabled = true;
 #endif
     // Create a threadpool of 1, so that we know that all queries will happen one at a time, from a single thread
     m_ThreadPool = FQueuedThreadPool::Allocate();
-    m_ThreadPool->Create(1);
+    m_ThreadPool->Create(c_NumQueryThreads);
 }
 
 void FProjectAcousticsModule::StartupModule()
@@ -83,8 +91,7 @@ void FProjectAcousticsModule::StartupModule()
         UE_LOG(LogAcousticsRuntime, Error, TEXT("Project Acoustics failed to create instance!"));
         return;
     }
-    m_SpaceTransform = FTransform::Identity;
-    m_InverseSpaceTransform = m_SpaceTransform.Inverse();
+    PublishFrameState();
 
 #if !UE_BUILD_SHIPPING
     // setup debug rendering for ourself
@@ -98,8 +105,10 @@ void FProjectAcousticsModule::ShutdownModule()
     // we call this function before unloading the module.
     if (m_Triton)
     {
-        // Make sure there are no lingering background queries still running
+        // Make sure there are no lingering background queries or loads still running
         WaitForRunningTasks();
+        WaitForPendingAceLoad();
+        ++m_AceLoadRequestId;
 
         TritonAcoustics::DestroyInstance(m_Triton);
         TritonAcoustics::TearDown();
@@ -150,6 +159,135 @@ bool FProjectAcousticsModule::LoadAceFile(const FString& filePath, const float c
     return true;
 }
 
+bool FProjectAcousticsModule::LoadAceFileAsync(
+    const FString& filePath, const float cacheScale, const FVector& firstTileCenter, const FVector& firstTileSize,
+    TFunction<void(bool)>&& onLoaded)
+{
+    if (!m_Triton)
+    {
+        return false;
+    }
+
+    UnloadAceFile(false);
+
+    m_TritonIOHook = TUniquePtr<FTritonUnrealIOHook>(new FTritonUnrealIOHook());
+    m_TritonTaskHook = TUniquePtr<FTritonAsyncTaskHook>(new FTritonAsyncTaskHook());
+    m_IsAceFileLoading = true;
+    const uint32 loadRequestId = ++m_AceLoadRequestId;
+
+    // The frame state is owned by the game thread, so the first tile is converted to Triton space up front
+    const bool loadFirstTile = !firstTileSize.IsNearlyZero();
+    const auto tileCenter = AcousticsUtils::ToTritonVectorDouble(m_PendingFrameState.WorldPositionToTriton(firstTileCenter));
+    const auto tileSize =
+        AcousticsUtils::ToTritonVectorDouble(m_PendingFrameState.WorldScaleToTriton(firstTileSize).GetAbs());
+
+    auto* triton = m_Triton;
+    auto* ioHook = m_TritonIOHook.Get();
+    auto* taskHook = m_TritonTaskHook.Get();
+    const auto fullFilePath = FPaths::ProjectDir() + filePath;
+    m_PendingAceLoad = Async(
+        EAsyncExecution::ThreadPool,
+        [this, triton, ioHook, taskHook, cacheScale, loadFirstTile, tileCenter, tileSize, fullFilePath, filePath,
+         loadRequestId, onLoaded = MoveTemp(onLoaded)]() -> bool
+        {
+            bool success = false;
+            {
+                SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadAce);
+                if (!ioHook->OpenForRead(TCHAR_TO_ANSI(*fullFilePath)))
+                {
+                    UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to open ACE file for reading: [%s]"), *fullFilePath);
+                }
+                else if (!triton->InitLoad(ioHook, taskHook, cacheScale))
+                {
+                    UE_LOG(LogAcousticsRuntime, Error, TEXT("Failed to load ACE file: [%s]"), *fullFilePath);
+                }
+                else
+                {
+                    success = true;
+                }
+            }
+
+            // Block this worker, not the game thread, until the probes around the player start are resident
+            if (success && loadFirstTile)
+            {
+                SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadRegion);
+                if (triton->LoadRegion(tileCenter, tileSize, true, true) < 0)
+                {
+                    UE_LOG(LogAcousticsRuntime, Warning, TEXT("Failed to load the first ACE tile for: [%s]"), *fullFilePath);
+                }
+            }
+
+            AsyncTask(
+                ENamedThreads::GameThread,
+                [this, loadRequestId, success, filePath, onLoaded]()
+                { OnAceFileLoaded(loadRequestId, success, filePath, onLoaded); });
+            return success;
+        });
+
+    return true;
+}
+
+void FProjectAcousticsModule::OnAceFileLoaded(
+    uint32 loadRequestId, bool success, const FString& filePath, TFunction<void(bool)> onLoaded)
+{
+    // Superseded by a newer load or an unload, which already cleaned up after this one
+    if (loadRequestId != m_AceLoadRequestId || !m_Triton)
+    {
+        return;
+    }
+
+    m_PendingAceLoad = TFuture<bool>();
+    m_IsAceFileLoading = false;
+
+    if (success)
+    {
+        m_AceFileLoaded = true;
+        // Distances from a previous ACE file are stale
+        m_DistanceListenerLocations.Reset();
+
+#if !UE_BUILD_SHIPPING
+        m_DebugRenderer->SetLoadedFilename(filePath);
+#endif
+    }
+    else
+    {
+        m_TritonIOHook.Reset();
+    }
+
+    // Openings and attenuation changes that arrived during the load can now be handed to Triton. Removals go
+    // first, so an opening removed and re-added during the load ends up registered
+    FlushDeferredDynamicOpeningRemovals();
+    for (const auto& deferred : m_DeferredDynamicOpenings)
+    {
+        AddDynamicOpening(deferred.Opening, deferred.Center, deferred.Normal, deferred.Vertices);
+    }
+    m_DeferredDynamicOpenings.Reset();
+    UpdateDynamicOpenings();
+
+    if (onLoaded)
+    {
+        onLoaded(success);
+    }
+}
+
+void FProjectAcousticsModule::WaitForPendingAceLoad()
+{
+    if (m_PendingAceLoad.IsValid())
+    {
+        m_PendingAceLoad.Wait();
+    }
+}
+
+void FProjectAcousticsModule::FlushDeferredDynamicOpeningRemovals()
+{
+    for (auto* opening : m_DeferredDynamicOpeningRemovals)
+    {
+        // Openings that were only ever deferred were never registered with Triton, so a failure here is expected
+        m_Triton->RemoveDynamicOpening(reinterpret_cast<uint64_t>(opening));
+    }
+    m_DeferredDynamicOpeningRemovals.Reset();
+}
+
 void FProjectAcousticsModule::UnloadAceFile(bool clearOldQueries)
 {
     if (!m_Triton)
@@ -157,7 +295,16 @@ void FProjectAcousticsModule::UnloadAceFile(bool clearOldQueries)
         return;
     }
 
-    if (m_AceFileLoaded)
+    // An in-flight load owns the Triton instance until it finishes. Its completion is dropped, and whatever it
+    // managed to load is cleared below
+    const bool wasLoading = m_IsAceFileLoading;
+    WaitForPendingAceLoad();
+    m_PendingAceLoad = TFuture<bool>();
+    m_IsAceFileLoading = false;
+    ++m_AceLoadRequestId;
+    FlushDeferredDynamicOpeningRemovals();
+
+    if (m_AceFileLoaded || wasLoading)
     {
         // Make sure there are no lingering background queries still running
         WaitForRunningTasks();
@@ -170,6 +317,7 @@ void FProjectAcousticsModule::UnloadAceFile(bool clearOldQueries)
         SCOPE_CYCLE_COUNTER(STAT_Acoustics_ClearAce);
         m_Triton->Clear();
         m_AceFileLoaded = false;
+        m_DistanceListenerLocations.Reset();
     }
 
     m_TritonIOHook.Reset();
@@ -215,6 +363,12 @@ bool FProjectAcousticsModule::AddDynamicOpening(
         return false;
     }
 
+    if (m_IsAceFileLoading)
+    {
+        m_DeferredDynamicOpenings.Add({opening, center, normal, verticesIn});
+        return true;
+    }
+
     TArray<Triton::Vec3f> vertices;
     for (auto& v : verticesIn)
     {
@@ -231,11 +385,23 @@ bool FProjectAcousticsModule::AddDynamicOpening(
 
 bool FProjectAcousticsModule::RemoveDynamicOpening(class UAcousticsDynamicOpening* opening)
 {
+    m_DirtyDynamicOpenings.Remove(opening);
+
     if (!m_Triton)
     {
         return false;
     }
 
+    if (m_IsAceFileLoading)
+    {
+        // Triton is owned by the load. Drop any pending add, and queue the removal in case the opening was
+        // registered before the load started
+        m_DeferredDynamicOpenings.RemoveAll([opening](const DeferredDynamicOpening& deferred)
+                                            { return deferred.Opening == opening; });
+        m_DeferredDynamicOpeningRemovals.AddUnique(opening);
+        return true;
+    }
+
     return m_Triton->RemoveDynamicOpening(reinterpret_cast<uint64_t>(opening));
 }
 
@@ -247,27 +413,57 @@ bool FProjectAcousticsModule::UpdateDynamicOpening(
         return false;
     }
 
+    if (m_IsAceFileLoading)
+    {
+        QueueDynamicOpeningUpdate(opening, dryAttenuationDb, wetAttenuationDb);
+        return true;
+    }
+
     return m_Triton->UpdateDynamicOpening(reinterpret_cast<uint64_t>(opening), dryAttenuationDb, wetAttenuationDb);
 }
 
+void FProjectAcousticsModule::QueueDynamicOpeningUpdate(
+    class UAcousticsDynamicOpening* opening, float dryAttenuationDb, float wetAttenuationDb)
+{
+    m_DirtyDynamicOpenings.Add(opening, TPair<float, float>(dryAttenuationDb, wetAttenuationDb));
+}
+
+bool FProjectAcousticsModule::UpdateDynamicOpenings()
+{
+    if (!m_Triton || m_IsAceFileLoading || m_DirtyDynamicOpenings.Num() == 0)
+    {
+        return m_Triton != nullptr;
+    }
+
+    bool success = true;
+    for (const auto& dirtyOpening : m_DirtyDynamicOpenings)
+    {
+        success &= m_Triton->UpdateDynamicOpening(
+            reinterpret_cast<uint64_t>(dirtyOpening.Key), dirtyOpening.Value.Key, dirtyOpening.Value.Value);
+    }
+    m_DirtyDynamicOpenings.Reset();
+
+    return success;
+}
+
+// Global design and space transform are staged on the game thread and only become visible to queries once the
+// frame state is published in PostTick
 bool FProjectAcousticsModule::SetGlobalDesign(const FAcousticsDesignParams& params)
 {
-    m_GlobalDesign = params;
+    m_PendingFrameState.GlobalDesign = params;
     return true;
 }
 
 void FProjectAcousticsModule::SetSpaceTransform(const FTransform& newTransform)
 {
-    m_SpaceTransform = newTransform;
-    m_InverseSpaceTransform = m_SpaceTransform.Inverse();
+    m_PendingFrameState.SpaceTransform = newTransform;
+    m_PendingFrameState.InverseSpaceTransform = newTransform.Inverse();
 }
 
 AcousticQueryResults FProjectAcousticsModule::GetAcousticQueryResults(
-    const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation, 
-    AcousticsObjectParams objectParams)
+    const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
+    AcousticsObjectParams objectParams, const AcousticsFrameState& frameState)
 {
-    UpdateOutdoorness(listenerLocation);
-
     TritonAcousticParameters acousticParams = {};
     // Need to pass over the state of ApplyDynamicOpenings
     TritonDynamicOpeningInfo openingInfo = objectParams.DynamicOpeningInfo;
@@ -278,12 +474,12 @@ AcousticQueryResults FProjectAcousticsModule::GetAcousticQueryResults(
     TritonRuntime::QueryDebugInfo queryDebugInfo;
 
     bool querySuccess = GetAcousticParameters(
-        sourceLocation, listenerLocation, acousticParams, openingInfo, interpConfig, &queryDebugInfo);
+        sourceLocation, listenerLocation, frameState, acousticParams, openingInfo, interpConfig, &queryDebugInfo);
 
     returnStruct.QueryDebugInfo = queryDebugInfo;
 #else
-    bool querySuccess =
-        GetAcousticParameters(sourceLocation, listenerLocation, acousticParams, openingInfo, interpConfig);
+    bool querySuccess = GetAcousticParameters(
+        sourceLocation, listenerLocation, frameState, acousticParams, openingInfo, interpConfig);
 #endif // !UE_BUILD_SHIPPING
 
     returnStruct.AcousticParams = acousticParams;
@@ -319,6 +515,8 @@ void FProjectAcousticsModule::RegisterSourceObject(const uint64_t sourceObjectId
 
     result.QueryResults = TFuture<AcousticQueryResults>();
     result.HasProcessed = false;
+    result.HasLastResults = false;
+    result.LastQueryTime = 0;
 }
 
 void FProjectAcousticsModule::UnregisterSourceObject(const uint64_t sourceObjectId)
@@ -383,6 +581,11 @@ bool FProjectAcousticsModule::UpdateObjectParameters(
     TritonDynamicOpeningInfo openingInfo = {};
     TritonRuntime::QueryDebugInfo queryDebugInfo = {};
 
+    // Grab this frame's state once. The same snapshot is used for the query and for filling in the shared,
+    // listener-only parameters below, even if the game thread publishes a new frame in the meantime
+    const AcousticsFrameStateRef frameState = GetFrameState();
+    const int32 listenerIndex = frameState->FindListenerIndex(listenerLocation);
+
     // We want to most acoustic queries on a background thread. So for each update call on a source, we will return any
     // past results and queue up a query to run in the background and be ready for the next call.
     bool alreadyStoredResult = false;
@@ -395,6 +598,16 @@ bool FProjectAcousticsModule::UpdateObjectParameters(
     // Check if we have past results for this source
     if (m_AcousticQueryResultMap.Contains(sourceObjectId))
     {
+        // Results computed for another listener, e.g. when the audio engine now spatializes this source for a
+        // different split-screen player, are of no use. Start over as if this source was new for this listener.
+        AsyncAcousticQueryResults& pastResults = m_AcousticQueryResultMap[sourceObjectId];
+        if (pastResults.HasProcessed && pastResults.ListenerIndex != listenerIndex)
+        {
+            pastResults.QueryResults.Reset();
+            pastResults.HasProcessed = false;
+            pastResults.HasLastResults = false;
+        }
+
         // Have the results been saved?
         if (m_AcousticQueryResultMap[sourceObjectId].QueryResults.IsReady())
         {
@@ -406,7 +619,9 @@ bool FProjectAcousticsModule::UpdateObjectParameters(
 #if !UE_BUILD_SHIPPING
             queryDebugInfo = results.QueryDebugInfo;
 #endif
-            m_AcousticQueryResultMap[sourceObjectId].QueryResults.Reset();
+            pastResults.QueryResults.Reset();
+            pastResults.LastResults = results;
+            pastResults.HasLastResults = true;
         }
         // This is the first time this source is being processed. Run the first acoustic query call directly on this
         // calling thread
@@ -416,7 +631,8 @@ bool FProjectAcousticsModule::UpdateObjectParameters(
             m_AcousticQueryResultMapLock.Unlock();
 
             // Do the query now
-            auto results = GetAcousticQueryResults(sourceObjectId, sourceLocation, listenerLocation, objectParams);
+            auto results =
+                GetAcousticQueryResults(sourceObjectId, sourceLocation, listenerLocation, objectParams, *frameState);
             // Save the results
             acousticParams = results.AcousticParams;
             openingInfo = results.OpeningInfo;
@@ -435,18 +651,30 @@ bool FProjectAcousticsModule::UpdateObjectParameters(
             AsyncAcousticQueryResults& result = m_AcousticQueryResultMap.FindOrAdd(sourceObjectId);
             result.QueryResults = newPromise.GetFuture();
             result.HasProcessed = true;
+            result.ListenerIndex = listenerIndex;
+            result.LastQueryTime = FPlatformTime::Seconds();
 
             alreadyStoredResult = true;
         }
+        // No new results yet. Either this source is waiting for its next scheduled query, or its last query hasn't
+        // completed yet because the worker is behind. Keep using the most recent results, the query rate controller
+        // will lower update rates until the worker keeps up.
+        else if (pastResults.HasLastResults)
+        {
+            const auto& results = pastResults.LastResults;
+            acousticParams = results.AcousticParams;
+            openingInfo = results.OpeningInfo;
+            querySuccess = results.QueryResult;
+#if !UE_BUILD_SHIPPING
+            queryDebugInfo = results.QueryDebugInfo;
+#endif
+        }
         else
         {
-            // No results were ready and this is not the first time this source has been processed. This probably means
-            // a background query didn't complete in time.
             UE_LOG(
                 LogAcousticsRuntime,
-                Warning,
-                TEXT("No acoustic query result found for source:%d. This most likely means a background query "
-                     "did not complete in time."),
+                Verbose,
+                TEXT("No acoustic query result found yet for source:%d. The background query has not completed."),
                 sourceObjectId);
         }
     }
@@ -464,52 +692,74 @@ bool FProjectAcousticsModule::UpdateObjectParameters(
 
     // Queue up the query to run on the background thread.
     // Don't do this if we already stored the results
-
     if (!alreadyStoredResult)
     {
-        // Function to perform an acoustic query on a separate thread and save the result to the local map
-        TFunction<void()> RunBackgroundAcousticsQuery(
-            [this, sourceObjectId, sourceLocation, listenerLocation, objectParams]()
-            {
-                // Run the acoustic query
-                auto results = GetAcousticQueryResults(
-                    sourceObjectId,
-                    sourceLocation,
-                    listenerLocation,
-                    objectParams);
-
-                FScopeLock lock(&m_AcousticQueryResultMapLock);
-                if (m_AcousticQueryResultMap.Contains(sourceObjectId))
-                {
-                    AsyncAcousticQueryResults& result = m_AcousticQueryResultMap[sourceObjectId];
-                    if (result.RetractionRequested)
-                    {
-                        // This task was attempted to be retracted but wasn't able to be. We don't want to store
-                        // these results. Exit early.
-                        result.RetractionRequested = false;
-                        return;
-                    }
-
-                    // Store the promise/future in the map for retrieval on the next update pass
-                    TPromise<AcousticQueryResults> newPromise;
-                    newPromise.SetValue(results);
-
-                    result.HasProcessed = true;
-                    result.QueryResults = newPromise.GetFuture();
-                }
-            });
+        const double now = FPlatformTime::Seconds();
 
         m_AcousticQueryResultMapLock.Lock();
         AsyncAcousticQueryResults& result = m_AcousticQueryResultMap.FindOrAdd(sourceObjectId);
+        result.QueryPriority = objectParams.QueryPriority;
+
+        // Periodically re-split the query budget across all active sources
+        if (m_QueryRateController.NeedsUpdate(now))
+        {
+            float totalPriority = 0.0f;
+            for (const auto& sourceResults : m_AcousticQueryResultMap)
+            {
+                totalPriority += sourceResults.Value.QueryPriority;
+            }
+            m_QueryRateController.Update(now, totalPriority);
+        }
+
+        // Only query as often as this source's share of the budget allows
+        const float queryRate = m_QueryRateController.GetQueryRate(result.QueryPriority);
+        const bool queryDue = (now - result.LastQueryTime) * queryRate >= 1.0;
 
         // If the last query is still running, we don't want to schedule a new one and fall behind. Skip the 
         // scheduling, and try again next pass.
         auto queryStillRunning =
             result.QueuedWork.IsValid() ? FPlatformAtomics::AtomicRead(&result.QueuedWork->m_IsQueuedOrRunning) : 0;
-        if (!queryStillRunning)
+        if (queryDue && !queryStillRunning)
         {
+            // Function to perform an acoustic query on a separate thread and save the result to the local map
+            TFunction<void()> RunBackgroundAcousticsQuery(
+                [this, sourceObjectId, sourceLocation, listenerLocation, listenerIndex, objectParams, frameState]()
+                {
+                    // Run the acoustic query
+                    const double queryStart = FPlatformTime::Seconds();
+                    auto results = GetAcousticQueryResults(
+                        sourceObjectId,
+                        sourceLocation,
+                        listenerLocation,
+                        objectParams,
+                        *frameState);
+                    m_QueryRateController.ReportQueryTime(FPlatformTime::Seconds() - queryStart);
+
+                    FScopeLock lock(&m_AcousticQueryResultMapLock);
+                    if (m_AcousticQueryResultMap.Contains(sourceObjectId))
+                    {
+                        AsyncAcousticQueryResults& result = m_AcousticQueryResultMap[sourceObjectId];
+                        if (result.RetractionRequested)
+                        {
+                            // This task was attempted to be retracted but wasn't able to be. We don't want to store
+                            // these results. Exit early.
+                            result.RetractionRequested = false;
+                            return;
+                        }
+
+                        // Store the promise/future in the map for retrieval on the next update pass
+                        TPromise<AcousticQueryResults> newPromise;
+                        newPromise.SetValue(results);
+
+                        result.HasProcessed = true;
+                        result.ListenerIndex = listenerIndex;
+                        result.QueryResults = newPromise.GetFuture();
+                    }
+                });
+
             // Queue up the acoustic query
             result.RetractionRequested = false;
+            result.LastQueryTime = now;
 
             // Save the QueuedWork item in case we want to retract it later
             result.QueuedWork = TUniquePtr<FAcousticsQueuedWork>(
@@ -554,15 +804,15 @@ bool FProjectAcousticsModule::UpdateObjectParameters(
 
     // Caller passes in design adjustments for this emitter,
     // update them with global adjustments
-    FAcousticsDesignParams::Combine(objectParams.Design, m_GlobalDesign);
+    FAcousticsDesignParams::Combine(objectParams.Design, frameState->GlobalDesign);
 
     // Set the remaining fields apart from design
     objectParams.ObjectId = sourceObjectId;
     objectParams.TritonParams = acousticParams;
     objectParams.DynamicOpeningInfo = openingInfo;
-    // Outdoorness value is shared across all emitters since it depends only on
-    // listener location (for now), fill in that shared value.
-    objectParams.Outdoorness = m_CachedOutdoorness;
+    // Outdoorness value is shared across all emitters heard by the same listener since it
+    // depends only on listener location (for now), fill in that shared value.
+    objectParams.Outdoorness = frameState->GetOutdoorness(listenerIndex);
 
 #if !UE_BUILD_SHIPPING
     // If acoustics is disabled, intercept parameters headed to DSP
@@ -594,70 +844,218 @@ bool FProjectAcousticsModule::PostTick()
     }
 
     m_IsOutdoornessStale = true;
+    PublishFrameState();
     return true;
 }
 
-bool FProjectAcousticsModule::UpdateDistances(const FVector& listenerLocation)
+void FProjectAcousticsModule::SetQueryRateLimits(float minRate, float maxRate)
 {
-    if (!m_Triton)
+    FScopeLock lock(&m_AcousticQueryResultMapLock);
+    m_QueryRateController.SetRateLimits(minRate, maxRate);
+}
+
+void FProjectAcousticsModule::OnAudioFrameProcessed()
+{
+    FScopeLock lock(&m_AcousticQueryResultMapLock);
+    m_QueryRateController.OnAudioFrame(FPlatformTime::Seconds());
+}
+
+void FProjectAcousticsModule::PublishFrameState()
+{
+    m_PendingFrameState.Version++;
+    AcousticsFrameStateRef newState = MakeShared<AcousticsFrameState, ESPMode::ThreadSafe>(m_PendingFrameState);
+
+    FScopeLock lock(&m_FrameStateLock);
+    m_FrameState = newState;
+}
+
+AcousticsFrameStateRef FProjectAcousticsModule::GetFrameState() const
+{
+    FScopeLock lock(&m_FrameStateLock);
+    return m_FrameState;
+}
+
+// Directions (in Triton coordinates) along which the distance map of secondary listeners is sampled.
+// All 26 neighbors of a voxel, which covers the sphere at roughly the width of Triton's distance cones.
+static const TArray<FVector>& GetDistanceSampleDirections()
+{
+    static const TArray<FVector> directions = []()
+    {
+        TArray<FVector> result;
+        for (int32 x = -1; x <= 1; x++)
+        {
+            for (int32 y = -1; y <= 1; y++)
+            {
+                for (int32 z = -1; z <= 1; z++)
+                {
+                    if (x != 0 || y != 0 || z != 0)
+                    {
+                        result.Add(FVector(x, y, z).GetSafeNormal());
+                    }
+                }
+            }
+        }
+        return result;
+    }();
+    return directions;
+}
+
+bool FProjectAcousticsModule::UpdateDistances(const TArray<FVector>& listenerLocations)
+{
+    if (!m_Triton || m_IsAceFileLoading)
     {
         return false;
     }
 
-    auto listener = AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(listenerLocation));
-    return m_Triton->UpdateDistancesForListener(listener);
+    const int32 numListeners = FMath::Min(listenerLocations.Num(), c_MaxAcousticsListeners);
+    if (numListeners == 0)
+    {
+        return false;
+    }
+
+    const auto needsUpdate = [](const TOptional<FVector>& lastLocation, const FVector& location)
+    { return !lastLocation.IsSet() || !lastLocation->Equals(location, c_DistanceListenerMoveTolerance); };
+
+    // Secondary listeners go first: fill Triton's distance map for each of them and sample it.
+    // The map is then left on the primary listener, which keeps querying it directly.
+    bool success = true;
+    bool mapMoved = false;
+    const auto& sampleDirections = GetDistanceSampleDirections();
+    m_SecondaryListenerDistances.SetNum(numListeners - 1);
+    m_DistanceListenerLocations.SetNum(numListeners);
+    for (int32 i = 1; i < numListeners; i++)
+    {
+        const auto location = m_PendingFrameState.WorldPositionToTriton(listenerLocations[i]);
+        auto& lastLocation = m_DistanceListenerLocations[i];
+        if (!needsUpdate(lastLocation, location))
+        {
+            continue;
+        }
+
+        mapMoved = true;
+        if (!m_Triton->UpdateDistancesForListener(AcousticsUtils::ToTritonVectorDouble(location)))
+        {
+            // Keep the last successful samples for this listener, and try again next update
+            lastLocation.Reset();
+            success = false;
+            continue;
+        }
+
+        auto& distances = m_SecondaryListenerDistances[i - 1];
+        distances.SetNumUninitialized(sampleDirections.Num());
+        for (int32 d = 0; d < sampleDirections.Num(); d++)
+        {
+            distances[d] = m_Triton->QueryDistanceForListener(AcousticsUtils::ToTritonVector(sampleDirections[d]));
+        }
+        lastLocation = location;
+    }
+
+    // The map only has to be rebuilt for the primary listener if it moved, or a secondary listener borrowed it
+    const auto location = m_PendingFrameState.WorldPositionToTriton(listenerLocations[0]);
+    auto& lastLocation = m_DistanceListenerLocations[0];
+    if (!mapMoved && !needsUpdate(lastLocation, location))
+    {
+        return success;
+    }
+
+    if (!m_Triton->UpdateDistancesForListener(AcousticsUtils::ToTritonVectorDouble(location)))
+    {
+        lastLocation.Reset();
+        return false;
+    }
+    lastLocation = location;
+    return success;
 }
 
-bool FProjectAcousticsModule::QueryDistance(const FVector& lookDirection, float& outDistance)
+bool FProjectAcousticsModule::QueryDistance(const FVector& lookDirection, float& outDistance, int32 listenerIndex)
 {
-    if (!m_Triton)
+    if (!m_Triton || m_IsAceFileLoading)
     {
         outDistance = 0;
         return false;
     }
 
-    auto dir = AcousticsUtils::ToTritonVector(WorldDirectionToTriton(lookDirection));
-    outDistance = m_Triton->QueryDistanceForListener(dir) * AcousticsUtils::c_TritonToUnrealScale;
-    return true;
+    auto dir = WorldDirectionToTriton(lookDirection);
+    if (listenerIndex == 0)
+    {
+        outDistance =
+            m_Triton->QueryDistanceForListener(AcousticsUtils::ToTritonVector(dir)) * AcousticsUtils::c_TritonToUnrealScale;
+        return true;
+    }
+
+    if (!m_SecondaryListenerDistances.IsValidIndex(listenerIndex - 1) ||
+        m_SecondaryListenerDistances[listenerIndex - 1].Num() == 0)
+    {
+        outDistance = 0;
+        return false;
+    }
+
+    // Blend the sampled distances, weighted towards the samples closest to the look direction
+    const auto& distances = m_SecondaryListenerDistances[listenerIndex - 1];
+    const auto& sampleDirections = GetDistanceSampleDirections();
+    float weightedDistance = 0.0f;
+    float totalWeight = 0.0f;
+    for (int32 d = 0; d < sampleDirections.Num(); d++)
+    {
+        const float alignment = FMath::Max(static_cast<float>(FVector::DotProduct(dir, sampleDirections[d])), 0.0f);
+        const float weight = FMath::Square(FMath::Square(alignment));
+        weightedDistance += weight * distances[d];
+        totalWeight += weight;
+    }
+
+    outDistance = totalWeight > 0 ? (weightedDistance / totalWeight) * AcousticsUtils::c_TritonToUnrealScale : 0;
+    return totalWeight > 0;
 }
 
-bool FProjectAcousticsModule::UpdateOutdoorness(const FVector& listenerLocation)
+bool FProjectAcousticsModule::UpdateOutdoorness(const TArray<FVector>& listenerLocations)
 {
-    if (!m_Triton)
+    if (!m_Triton || m_IsAceFileLoading)
     {
         return false;
     }
 
-    // This function will be called by each sound source in a frame.
-    // Since outdoorness depends only on player location, we do work
-    // only once per frame, regardless of whether query succeeds or fails.
-    // In case of failure, we leave the old cached outdoorness value unmodified.
-    if (m_IsOutdoornessStale)
+    // Outdoorness depends only on listener locations, so it is computed on the game thread
+    // once per frame, regardless of whether queries succeed or fail, and handed to all sources
+    // through the published frame state.
+    if (!m_IsOutdoornessStale)
     {
-        auto listener = AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(listenerLocation));
-        bool success = false;
+        return true;
+    }
+    m_IsOutdoornessStale = false;
+
+    // Resizing keeps the cached values of existing listeners. In case of failure, we leave
+    // the old cached outdoorness value of that listener unmodified.
+    const int32 numListeners = FMath::Min(listenerLocations.Num(), c_MaxAcousticsListeners);
+    m_PendingFrameState.Listeners.SetNum(numListeners);
+
+    bool success = true;
+    SCOPE_CYCLE_COUNTER(STAT_Acoustics_QueryOutdoorness);
+    for (int32 i = 0; i < numListeners; i++)
+    {
+        auto& listenerState = m_PendingFrameState.Listeners[i];
+        listenerState.Location = listenerLocations[i];
+
+        auto listener =
+            AcousticsUtils::ToTritonVectorDouble(m_PendingFrameState.WorldPositionToTriton(listenerLocations[i]));
+        auto outdoorness = 0.0f;
+        if (m_Triton->GetOutdoornessAtListener(listener, outdoorness))
         {
-            SCOPE_CYCLE_COUNTER(STAT_Acoustics_QueryOutdoorness);
-            auto outdoorness = 0.0f;
-            success = m_Triton->GetOutdoornessAtListener(listener, outdoorness);
-            if (success)
-            {
-                const float NormalizedVal =
-                    (outdoorness - c_OutdoornessIndoors) / (c_OutdoornessOutdoors - c_OutdoornessIndoors);
-                m_CachedOutdoorness = FMath::Clamp(NormalizedVal, 0.0f, 1.0f);
-            }
+            const float NormalizedVal =
+                (outdoorness - c_OutdoornessIndoors) / (c_OutdoornessOutdoors - c_OutdoornessIndoors);
+            listenerState.Outdoorness = FMath::Clamp(NormalizedVal, 0.0f, 1.0f);
+        }
+        else
+        {
+            success = false;
         }
-
-        m_IsOutdoornessStale = false;
-        return success;
     }
 
-    return true;
+    return success;
 }
 
-inline float FProjectAcousticsModule::GetOutdoorness() const
+float FProjectAcousticsModule::GetOutdoorness(int32 listenerIndex) const
 {
-    return m_CachedOutdoorness;
+    return GetFrameState()->GetOutdoorness(listenerIndex);
 }
 
 bool FProjectAcousticsModule::CalculateReverbSendWeights(
@@ -668,11 +1066,12 @@ bool FProjectAcousticsModule::CalculateReverbSendWeights(
 
 
 bool FProjectAcousticsModule::GetAcousticParameters(
-    const FVector& sourceLocation, const FVector& listenerLocation, TritonAcousticParameters& params,
-    TritonDynamicOpeningInfo& outOpeningInfo, const InterpolationConfig& interpConfig, TritonRuntime::QueryDebugInfo* outDebugInfo /* = nullptr */)
+    const FVector& sourceLocation, const FVector& listenerLocation, const AcousticsFrameState& frameState,
+    TritonAcousticParameters& params, TritonDynamicOpeningInfo& outOpeningInfo, const InterpolationConfig& interpConfig,
+    TritonRuntime::QueryDebugInfo* outDebugInfo /* = nullptr */)
 {
-    auto source = AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(sourceLocation));
-    auto listener = AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(listenerLocation));
+    auto source = AcousticsUtils::ToTritonVectorDouble(frameState.WorldPositionToTriton(sourceLocation));
+    auto listener = AcousticsUtils::ToTritonVectorDouble(frameState.WorldPositionToTriton(listenerLocation));
 
     bool acousticParamsValid = false;
     {
@@ -703,7 +1102,7 @@ void FProjectAcousticsModule::UpdateLoadedRegion(
     const FVector& playerPosition, const FVector& tileSize, const bool forceUpdate, const bool unloadProbesOutsideTile,
     const bool blockOnCompletion)
 {
-    if (!m_Triton)
+    if (!m_Triton || m_IsAceFileLoading)
     {
         return;
     }
@@ -718,8 +1117,8 @@ void FProjectAcousticsModule::UpdateLoadedRegion(
         {
             SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadRegion);
             loadedProbes = m_Triton->LoadRegion(
-                AcousticsUtils::ToTritonVectorDouble(WorldPositionToTriton(playerPosition)),
-                AcousticsUtils::ToTritonVectorDouble(WorldScaleToTriton(tileSize).GetAbs()),
+                AcousticsUtils::ToTritonVectorDouble(m_PendingFrameState.WorldPositionToTriton(playerPosition)),
+                AcousticsUtils::ToTritonVectorDouble(m_PendingFrameState.WorldScaleToTriton(tileSize).GetAbs()),
                 unloadProbesOutsideTile,
                 blockOnCompletion);
         }
@@ -728,58 +1127,160 @@ void FProjectAcousticsModule::UpdateLoadedRegion(
             m_LastLoadCenterPosition = playerPosition;
             // Tile Size must be all positive values, otherwise triton fails to load probes
             m_LastLoadTileSize = tileSize.GetAbs();
+
+            // Regions loaded for other listeners may have just been unloaded. Have the next
+            // multi-listener update reload them
+            if (unloadProbesOutsideTile)
+            {
+                m_LastLoadListenerPositions.Reset();
+                m_LoadedRegions.Reset();
+            }
         }
     }
 }
 
+void FProjectAcousticsModule::UpdateLoadedRegions(const TArray<FVector>& listenerPositions, const FVector& tileSize)
+{
+    if (!m_Triton || m_IsAceFileLoading)
+    {
+        return;
+    }
+
+    const int32 numListeners = FMath::Min(listenerPositions.Num(), c_MaxAcousticsListeners);
+    if (numListeners == 0)
+    {
+        return;
+    }
+
+    // Same load margin as single listener streaming, applied to each listener
+    const auto absTileSize = tileSize.GetAbs();
+    bool shouldUpdate = numListeners != m_LastLoadListenerPositions.Num() || absTileSize != m_LastLoadTileSize;
+    const auto loadThreshold = absTileSize * c_AceTileLoadMargin * 0.5f;
+    for (int32 i = 0; i < numListeners && !shouldUpdate; i++)
+    {
+        const auto difference = (listenerPositions[i] - m_LastLoadListenerPositions[i]).GetAbs();
+        shouldUpdate = difference.X > loadThreshold.X || difference.Y > loadThreshold.Y || difference.Z > loadThreshold.Z;
+    }
+
+    if (!shouldUpdate)
+    {
+        return;
+    }
+
+    // Merge overlapping listener tiles, so listeners close to each other share one region
+    TArray<FBox, TInlineAllocator<c_MaxAcousticsListeners>> regions;
+    for (int32 i = 0; i < numListeners; i++)
+    {
+        regions.Add(FBox(listenerPositions[i] - absTileSize * 0.5f, listenerPositions[i] + absTileSize * 0.5f));
+    }
+    for (bool merged = true; merged;)
+    {
+        merged = false;
+        for (int32 i = 0; i < regions.Num() && !merged; i++)
+        {
+            for (int32 j = i + 1; j < regions.Num() && !merged; j++)
+            {
+                if (regions[i].Intersect(regions[j]))
+                {
+                    regions[i] += regions[j];
+                    regions.RemoveAtSwap(j);
+                    merged = true;
+                }
+            }
+        }
+    }
+
+    bool success = true;
+    {
+        SCOPE_CYCLE_COUNTER(STAT_Acoustics_LoadRegion);
+        if (regions.Num() == 1)
+        {
+            // All listeners share one region. Same as single listener streaming
+            success = m_Triton->LoadRegion(
+                          AcousticsUtils::ToTritonVectorDouble(
+                              m_PendingFrameState.WorldPositionToTriton(regions[0].GetCenter())),
+                          AcousticsUtils::ToTritonVectorDouble(
+                              m_PendingFrameState.WorldScaleToTriton(regions[0].GetSize()).GetAbs()),
+                          true,
+                          false) >= 0;
+        }
+        else
+        {
+            // Asynchronously unload the old regions and load the new ones. Triton cancels out an unload
+            // followed by a load of the same probe, so probes in the overlap of old and new regions cause no I/O
+            for (const auto& region : m_LoadedRegions)
+            {
+                m_Triton->UnloadRegion(
+                    AcousticsUtils::ToTritonVectorDouble(m_PendingFrameState.WorldPositionToTriton(region.GetCenter())),
+                    AcousticsUtils::ToTritonVectorDouble(
+                        m_PendingFrameState.WorldScaleToTriton(region.GetSize()).GetAbs()),
+                    false);
+            }
+            for (const auto& region : regions)
+            {
+                success &= m_Triton->LoadRegion(
+                               AcousticsUtils::ToTritonVectorDouble(
+                                   m_PendingFrameState.WorldPositionToTriton(region.GetCenter())),
+                               AcousticsUtils::ToTritonVectorDouble(
+                                   m_PendingFrameState.WorldScaleToTriton(region.GetSize()).GetAbs()),
+                               false,
+                               false) >= 0;
+            }
+        }
+    }
+
+    if (success)
+    {
+        m_LastLoadListenerPositions = TArray<FVector, TInlineAllocator<c_MaxAcousticsListeners>>(
+            listenerPositions.GetData(), numListeners);
+        m_LoadedRegions = regions;
+        m_LastLoadTileSize = absTileSize;
+    }
+}
+
+// The conversions below may be called from the audio thread, so they always use the published frame state
 FVector FProjectAcousticsModule::TritonPositionToWorld(const FVector& vec) const
 {
-    auto vectorInUnrealCoords = AcousticsUtils::TritonPositionToUnreal(vec);
-    return m_SpaceTransform.TransformPosition(vectorInUnrealCoords);
+    return GetFrameState()->TritonPositionToWorld(vec);
 }
 
 FVector FProjectAcousticsModule::WorldPositionToTriton(const FVector& vec) const
 {
-    auto vectorWithTx = m_InverseSpaceTransform.TransformPosition(vec);
-    return AcousticsUtils::UnrealPositionToTriton(vectorWithTx);
+    return GetFrameState()->WorldPositionToTriton(vec);
 }
 
 FVector FProjectAcousticsModule::TritonScaleToWorld(const FVector& vec) const
 {
-    auto vectorInUnrealCoords = AcousticsUtils::TritonPositionToUnreal(vec);
-    return vectorInUnrealCoords * m_SpaceTransform.GetScale3D();
+    return GetFrameState()->TritonScaleToWorld(vec);
 }
 
 FVector FProjectAcousticsModule::WorldScaleToTriton(const FVector& vec) const
 {
-    auto vectorWithScale = vec * m_InverseSpaceTransform.GetScale3D();
-    return AcousticsUtils::UnrealPositionToTriton(vectorWithScale);
+    return GetFrameState()->WorldScaleToTriton(vec);
 }
 
 FVector FProjectAcousticsModule::TritonDirectionToWorld(const FVector& vec) const
 {
-    auto directionInUnrealCoords = AcousticsUtils::TritonDirectionToUnreal(vec);
-    return m_SpaceTransform.TransformVectorNoScale(directionInUnrealCoords);
+    return GetFrameState()->TritonDirectionToWorld(vec);
 }
 
 FVector FProjectAcousticsModule::WorldDirectionToTriton(const FVector& vec) const
 {
-    auto directionWithTx = m_InverseSpaceTransform.TransformVectorNoScale(vec);
-    return AcousticsUtils::UnrealDirectionToTriton(directionWithTx);
+    return GetFrameState()->WorldDirectionToTriton(vec);
 }
 
 VectorF FProjectAcousticsModule::TritonDirectionToHrtfEngine(const VectorF& vec) const
 {
     FVector vecD =
         AcousticsUtils::ToFVector(vec); // float to double because the inverse space transform requires double
-    auto directionWithTx = m_InverseSpaceTransform.TransformVectorNoScale(vecD);
+    auto directionWithTx = GetFrameState()->InverseSpaceTransform.TransformVectorNoScale(vecD);
     auto hrtfDirectionWithTx = AcousticsUtils::TritonDirectionToHrtfEngine(directionWithTx);
     return VectorF(hrtfDirectionWithTx.X, hrtfDirectionWithTx.Y, hrtfDirectionWithTx.Z); // back to float
 }
 
 FQuat FProjectAcousticsModule::GetSpaceRotation() const
 {
-    return m_SpaceTransform.GetRotation();
+    return GetFrameState()->SpaceTransform.GetRotation();
 }
 
 #if !UE_BUILD_SHIPPING
@@ -818,7 +1319,7 @@ void FProjectAcousticsModule::DebugRender(
     bool shouldDrawStats, bool shouldDrawVoxels, bool shouldDrawProbes, bool shouldDrawDistances,
     AcousticsDrawParameters shouldDrawSourceParameters)
 {
-    if (!m_Triton)
+    if (!m_Triton || m_IsAceFileLoading)
     {
         return;
     }
@@ -157,4 +157,7 @@ struct AcousticsObjectParams
     TritonDynamicOpeningInfo DynamicOpeningInfo;
     //! Additional settings for the interpolator for this source
     TritonRuntime::InterpolationConfig InterpolationConfig;
+    //! How important it is to keep this voice's acoustics up to date, 0 to 1. Under heavy query load,
+    //! voices with low priority are updated less often
+    float QueryPriority = 1.0f;
 };
\ No newline at end of file
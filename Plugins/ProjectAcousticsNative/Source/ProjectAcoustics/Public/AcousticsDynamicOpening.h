@@ -18,17 +18,19 @@ class PROJECTACOUSTICS_API UAcousticsDynamicOpening : public UStaticMeshComponen
     GENERATED_UCLASS_BODY()
 
 public:
-    /** Specify dB attenuation on dry audio going through this opening
+    /** Specify dB attenuation on dry audio going through this opening.
+     * At runtime, change this through SetDryAttenuationDb so the acoustics system is notified.
      */
     UPROPERTY(
-        EditAnywhere, BlueprintReadWrite, Category = "Acoustics",
+        EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetDryAttenuationDb, Category = "Acoustics",
         meta = (UIMin = -120, ClampMin = -120, UIMax = 0, ClampMax = 0))
     float DryAttenuationDb;
 
-    /** Specify dB attenuation on wet audio going through this opening
+    /** Specify dB attenuation on wet audio going through this opening.
+     * At runtime, change this through SetWetAttenuationDb so the acoustics system is notified.
      */
     UPROPERTY(
-        EditAnywhere, BlueprintReadWrite, Category = "Acoustics",
+        EditAnywhere, BlueprintReadWrite, BlueprintSetter = SetWetAttenuationDb, Category = "Acoustics",
         meta = (UIMin = -120, ClampMin = -120, UIMax = 0, ClampMax = 0))
     float WetAttenuationDb;
 
@@ -41,6 +43,23 @@ public:
         meta = (UIMin = 0, ClampMin = 0, UIMax = 1, ClampMax = 1))
     float Filtering;
 
+    /** Set dB attenuation on dry audio going through this opening.
+     * The change is sent to the acoustics system with the next batched opening update.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Acoustics")
+    void SetDryAttenuationDb(float NewDryAttenuationDb);
+
+    /** Set dB attenuation on wet audio going through this opening.
+     * The change is sent to the acoustics system with the next batched opening update.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Acoustics")
+    void SetWetAttenuationDb(float NewWetAttenuationDb);
+
+    /** Set both dry and wet dB attenuation on audio going through this opening.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Acoustics")
+    void SetAttenuationDb(float NewDryAttenuationDb, float NewWetAttenuationDb);
+
     virtual bool IsEditorOnly() const override
     {
         return false;
@@ -49,8 +68,6 @@ public:
     // Overridden methods
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason);
-    virtual void
-    TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
     virtual void OnUpdateTransform(
         EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport = ETeleportType::None) override;
@@ -60,6 +77,8 @@ private:
 
     void FlattenZ();
     FName Name() const;
+    // Queue the current attenuation values to be pushed to the acoustics system on the next batched update
+    void MarkAttenuationDirty();
 
     UPROPERTY()
     TArray<FVector> Vertices;
@@ -19,6 +19,8 @@ enum class AcousticsDrawParameters : uint8
     PerSourceControl
 };
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnAcousticsReady);
+
 // Loads the Project Acoustics data file (.ACE) and contains the global settings for acoustics. One of these is needed
 // per level.
 UCLASS(
@@ -62,6 +64,12 @@ public:
     UPROPERTY(EditAnywhere, Category = "Acoustics")
     bool UpdateDistances;
 
+    /** Broadcast once the ACE file has finished loading in the background and the tile around the player start is
+     * resident. Acoustic effects are not applied before this. Check IsAcousticsReady() before binding late.
+     */
+    UPROPERTY(BlueprintAssignable, Category = "Acoustics")
+    FOnAcousticsReady OnAcousticsReady;
+
     /////////////////// DESIGN CONTROLS //////////////////
     /**
      *	The design params used to override acoustics for all sound sources in the scene
@@ -127,26 +135,34 @@ public:
     void ForceLoadTile(FVector centerPosition, bool unloadProbesOutsideTile, bool blockOnCompletion);
 
     /** Load the ACE file specified by AcousticsData. If newBake is null, will unload any previously loaded data.
-        Returns true on success, false if there was a problem loading/unloading the data. */
+        The file is loaded in the background and OnAcousticsReady fires when it is done.
+        Returns true if the load was started or the data was unloaded, false if there was a problem. */
     UFUNCTION(BlueprintCallable, Category = "Acoustics")
     bool LoadAcousticsData(UAcousticsData* newBake);
 
+    /** Whether the ACE file has finished loading and acoustic queries are running.
+     */
+    UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Acoustics")
+    bool IsAcousticsReady() const;
+
     /** Get distance from listener looking in given direction using an internal
      * baked distance map that is updated if UpdateDistances is true.
      * The value is smoothed over a cone and precomputed, so it is not sensitive
      * to small geometry and doesn't cost real-time ray tracing. Useful for
      * hooking up discrete reflections or general geometric query.
+     * Listener 0 is the first local player, additional split-screen players or spectators follow.
      */
     UFUNCTION(BlueprintCallable, Category = "Acoustics")
-    bool QueryDistance(const FVector lookDirection, float& distance);
+    bool QueryDistance(const FVector lookDirection, float& distance, int32 listenerIndex = 0);
 
     /** Get the current "outdoorness" value at listener location.
      * 0 is fully indoors, 1 is fully outdoors. Value will vary smoothly
      * as player walks from inside a room to outside. Can be useful for
      * controlling loudness of outdoor ambiences like wind or rain.
+     * Listener 0 is the first local player, additional split-screen players or spectators follow.
      */
     UFUNCTION(BlueprintCallable, Category = "Acoustics")
-    bool GetOutdoorness(float& outdoorness);
+    bool GetOutdoorness(float& outdoorness, int32 listenerIndex = 0);
 
     /** Toggle acoustic effects on or off. In the off state, the effects
      * will be as if there were no geometry in the world. There
@@ -172,7 +188,15 @@ private:
     // Helper to convert from UAcousticsData to a real filepath that Triton can load
     bool LoadAceFile(FString filePath);
     FVector GetListenerPosition();
+    // Gathers the audio listener positions of all local player controllers
+    void GetListenerPositions(TArray<FVector>& outPositions);
+    // Called on the game thread when a background ACE load finishes
+    void OnAceFileLoaded(bool success, FString filePath);
     class IAcoustics* m_Acoustics;
+    bool m_IsAcousticsReady;
+
+    // Reused every tick to avoid reallocating
+    TArray<FVector> m_ListenerPositions;
 
     FTransform m_LastSpaceTransform;
 
@@ -50,6 +50,25 @@ public:
      */
     virtual bool LoadAceFile(const FString& filePath, const float cacheScale) = 0;
 
+    /**
+     * Starts loading the ACE file on a background thread. Acoustic queries are skipped until the load completes.
+     * If a non-zero first tile size is given, the probes in that tile are made resident before the load completes,
+     * so the area around the player start is ready as soon as the callback fires.
+     *
+     * @param firstTileCenter - World position of the first tile to load, usually the player start
+     * @param firstTileSize - Size of the first tile to load. Zero skips the initial tile load
+     * @param onLoaded - Called on the game thread with the load result. Not called if the load was superseded
+     * @return True if the load was started
+     */
+    virtual bool LoadAceFileAsync(
+        const FString& filePath, const float cacheScale, const FVector& firstTileCenter, const FVector& firstTileSize,
+        TFunction<void(bool)>&& onLoaded) = 0;
+
+    /**
+     * Whether an asynchronous ACE load started by LoadAceFileAsync is still in flight
+     */
+    virtual bool IsAceFileLoading() const = 0;
+
     /**
      * Unload the currently loaded ACE file.
      *
@@ -78,6 +97,20 @@ public:
     virtual bool
     UpdateDynamicOpening(class UAcousticsDynamicOpening* opening, float dryAttenuationDb, float wetAttenuationDb) = 0;
 
+    /**
+     * Queue a state change of a dynamic opening. Queued changes are applied together by UpdateDynamicOpenings.
+     * Queuing the same opening again before the flush only keeps the latest values.
+     */
+    virtual void QueueDynamicOpeningUpdate(
+        class UAcousticsDynamicOpening* opening, float dryAttenuationDb, float wetAttenuationDb) = 0;
+
+    /**
+     * Apply all queued dynamic opening changes. Called once per frame from the game thread.
+     *
+     * @return True if all queued updates succeeded.
+     */
+    virtual bool UpdateDynamicOpenings() = 0;
+
     /**
      * Sets global design settings that are applied to all acoustic queries
      */
@@ -122,27 +155,49 @@ public:
      */
     virtual void UnregisterSourceObject(const uint64_t sourceObjectId) = 0;
 
-    virtual bool UpdateOutdoorness(const FVector& listenerLocation) = 0;
-    virtual float GetOutdoorness() const = 0;
+    /**
+     * Sets the active listeners (split-screen players, spectator cameras) and computes outdoorness at each of them.
+     * Only does work once per frame, must be called from the game thread before PostTick. The results become
+     * visible through GetOutdoorness once the frame state is published. Index 0 is the primary listener.
+     */
+    virtual bool UpdateOutdoorness(const TArray<FVector>& listenerLocations) = 0;
+    virtual float GetOutdoorness(int32 listenerIndex = 0) const = 0;
     virtual bool CalculateReverbSendWeights(
         const float targetReverbTime, const uint32_t numReverbs, const float* reverbTimes,
         float* reverbSendWeights) const = 0;
 
+    /**
+     * Signals that the game thread is done updating per-frame state (space transform, global design, outdoorness).
+     * Publishes an immutable snapshot of that state which all acoustic queries issued afterwards will use.
+     */
     virtual bool PostTick() = 0;
 
     /**
-     * Update Triton's internal listener distance data based on given listener location
+     * Sets the range of acoustic query updates per second a single source may get. When the query worker can't
+     * keep up with all sources, quiet and distant sources are lowered towards the min rate first.
+     */
+    virtual void SetQueryRateLimits(float minRate, float maxRate) = 0;
+
+    /**
+     * Called from the audio renderer once all sources of an audio frame have been updated.
+     * Used to measure the audio frame time when adapting query rates.
+     */
+    virtual void OnAudioFrameProcessed() = 0;
+
+    /**
+     * Update Triton's internal listener distance data based on given listener locations. Index 0 is the primary
+     * listener.
      *
      * @return True on success.
      */
-    virtual bool UpdateDistances(const FVector& listenerLocation) = 0;
+    virtual bool UpdateDistances(const TArray<FVector>& listenerLocations) = 0;
 
     /**
-     * Gives smoothed, precomputed distance in a given look direction from the listener's point of view.
+     * Gives smoothed, precomputed distance in a given look direction from the given listener's point of view.
      *
      * @return distance value
      */
-    virtual bool QueryDistance(const FVector& lookDirection, float& outDistance) = 0;
+    virtual bool QueryDistance(const FVector& lookDirection, float& outDistance, int32 listenerIndex = 0) = 0;
 
     /**
      * Used for ACE streaming. For the given player position, update which parts of the ACE file are loaded in memory
@@ -151,6 +206,12 @@ public:
         const FVector& playerPosition, const FVector& tileSize, const bool forceUpdate,
         const bool unloadProbesOutsideTile, const bool blockOnCompletion) = 0;
 
+    /**
+     * Used for ACE streaming with multiple listeners. Keeps a tile loaded around each listener. Listeners whose
+     * tiles overlap share a single load covering all of them, so nearby listeners don't cause duplicate I/O.
+     */
+    virtual void UpdateLoadedRegions(const TArray<FVector>& listenerPositions, const FVector& tileSize) = 0;
+
     // Convert between a world position (UE coordinates) to Triton
     // Takes into account any active transformations of the AcousticsSpace actor
     virtual FVector TritonPositionToWorld(const FVector& vec) const = 0;
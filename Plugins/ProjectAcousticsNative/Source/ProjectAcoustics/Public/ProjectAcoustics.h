@@ -6,6 +6,7 @@
 #include "Modules/ModuleManager.h"
 #include "IAcoustics.h"
 #include "UnrealTritonHooks.h"
+#include "AcousticsQueryRateController.h"
 #include "AcousticsDesignParams.h"
 #include "TritonDebugInterface.h"
 #include "Async/Async.h"
@@ -72,6 +73,84 @@ struct AcousticQueryResults
     bool QueryResult;
 };
 
+// Per-listener state that only depends on the listener location
+struct AcousticsListenerState
+{
+    FVector Location = FVector::ZeroVector;
+    float Outdoorness = 0.0f;
+};
+
+// Maximum number of listeners tracked at once. Matches the maximum number of local split-screen players
+constexpr int32 c_MaxAcousticsListeners = 4;
+
+// Snapshot of all the per-frame state that acoustic queries depend on. A new snapshot is built on the game thread
+// and published once per frame in PostTick. Published snapshots are never modified, so background queries can hold
+// on to one for the duration of a query without taking any locks.
+struct AcousticsFrameState
+{
+    // Incremented each time a new snapshot is published
+    uint64 Version = 0;
+    FTransform SpaceTransform = FTransform::Identity;
+    FTransform InverseSpaceTransform = FTransform::Identity;
+    FAcousticsDesignParams GlobalDesign = FAcousticsDesignParams::Default();
+    TArray<AcousticsListenerState, TInlineAllocator<c_MaxAcousticsListeners>> Listeners;
+
+    // Index of the listener at the given listener location. The audio engine passes the location of the listener
+    // it is spatializing a source for, so the nearest listener is that same listener
+    int32 FindListenerIndex(const FVector& listenerLocation) const
+    {
+        int32 closestIndex = INDEX_NONE;
+        double closestDistSq = TNumericLimits<double>::Max();
+        for (int32 i = 0; i < Listeners.Num(); i++)
+        {
+            const double distSq = FVector::DistSquared(Listeners[i].Location, listenerLocation);
+            if (distSq < closestDistSq)
+            {
+                closestDistSq = distSq;
+                closestIndex = i;
+            }
+        }
+        return closestIndex;
+    }
+
+    float GetOutdoorness(int32 listenerIndex) const
+    {
+        return Listeners.IsValidIndex(listenerIndex) ? Listeners[listenerIndex].Outdoorness : 0.0f;
+    }
+
+    FVector TritonPositionToWorld(const FVector& vec) const
+    {
+        return SpaceTransform.TransformPosition(AcousticsUtils::TritonPositionToUnreal(vec));
+    }
+
+    FVector WorldPositionToTriton(const FVector& vec) const
+    {
+        return AcousticsUtils::UnrealPositionToTriton(InverseSpaceTransform.TransformPosition(vec));
+    }
+
+    FVector TritonScaleToWorld(const FVector& vec) const
+    {
+        return AcousticsUtils::TritonPositionToUnreal(vec) * SpaceTransform.GetScale3D();
+    }
+
+    FVector WorldScaleToTriton(const FVector& vec) const
+    {
+        return AcousticsUtils::UnrealPositionToTriton(vec * InverseSpaceTransform.GetScale3D());
+    }
+
+    FVector TritonDirectionToWorld(const FVector& vec) const
+    {
+        return SpaceTransform.TransformVectorNoScale(AcousticsUtils::TritonDirectionToUnreal(vec));
+    }
+
+    FVector WorldDirectionToTriton(const FVector& vec) const
+    {
+        return AcousticsUtils::UnrealDirectionToTriton(InverseSpaceTransform.TransformVectorNoScale(vec));
+    }
+};
+
+typedef TSharedRef<const AcousticsFrameState, ESPMode::ThreadSafe> AcousticsFrameStateRef;
+
 // Holds the data for a queued acoustics query
 struct AsyncAcousticQueryResults
 {
@@ -83,6 +162,14 @@ struct AsyncAcousticQueryResults
     bool HasProcessed = false;
     // Whether or not a retraction has been issued on this async query
     bool RetractionRequested = false;
+    // The listener the results were computed for. Results for one listener are never handed out for another
+    int32 ListenerIndex = INDEX_NONE;
+    // Most recent results handed out. Re-used while the source waits for its next scheduled query
+    AcousticQueryResults LastResults;
+    bool HasLastResults = false;
+    // When the last query for this source was scheduled, and the source's latest query priority
+    double LastQueryTime = 0;
+    float QueryPriority = 1.0f;
 };
 
 class FProjectAcousticsModule : public IAcoustics
@@ -97,6 +184,13 @@ public:
     // IAcoustics
     virtual bool LoadAceFile(const FString& filePath, const float cacheScale) override;
     virtual void UnloadAceFile(bool clearOldQueries) override;
+    virtual bool LoadAceFileAsync(
+        const FString& filePath, const float cacheScale, const FVector& firstTileCenter, const FVector& firstTileSize,
+        TFunction<void(bool)>&& onLoaded) override;
+    virtual bool IsAceFileLoading() const override
+    {
+        return m_IsAceFileLoading;
+    }
 
     virtual bool AddDynamicOpening(
         class UAcousticsDynamicOpening* opening, const FVector& center, const FVector& normal,
@@ -104,6 +198,9 @@ public:
     virtual bool RemoveDynamicOpening(class UAcousticsDynamicOpening* opening) override;
     virtual bool UpdateDynamicOpening(
         class UAcousticsDynamicOpening* opening, float dryAttenuationDb, float wetAttenuationDb) override;
+    virtual void QueueDynamicOpeningUpdate(
+        class UAcousticsDynamicOpening* opening, float dryAttenuationDb, float wetAttenuationDb) override;
+    virtual bool UpdateDynamicOpenings() override;
 
     virtual bool SetGlobalDesign(const FAcousticsDesignParams& params) override;
     virtual void SetSpaceTransform(const FTransform& newTransform) override;
@@ -113,24 +210,31 @@ public:
         AcousticsObjectParams& parameters) override;
     virtual AcousticQueryResults GetAcousticQueryResults(
         const uint64_t sourceObjectId, const FVector& sourceLocation, const FVector& listenerLocation,
-        AcousticsObjectParams objectParams);
+        AcousticsObjectParams objectParams, const AcousticsFrameState& frameState);
 
     virtual void RegisterSourceObject(const uint64_t sourceObjectId) override;
     virtual void UnregisterSourceObject(const uint64_t sourceObjectId) override;
 
-    virtual bool UpdateOutdoorness(const FVector& listenerLocation) override;
-    virtual float GetOutdoorness() const override;
+    virtual bool UpdateOutdoorness(const TArray<FVector>& listenerLocations) override;
+    virtual float GetOutdoorness(int32 listenerIndex = 0) const override;
     virtual bool CalculateReverbSendWeights(
         const float targetReverbTime, const uint32_t numReverbs, const float* reverbTimes,
         float* reverbSendWeights) const override;
 
     virtual bool PostTick() override;
 
-    virtual bool UpdateDistances(const FVector& listenerLocation) override;
-    virtual bool QueryDistance(const FVector& lookDirection, float& outDistance) override;
+    virtual void SetQueryRateLimits(float minRate, float maxRate) override;
+    virtual void OnAudioFrameProcessed() override;
+
+    // Returns the most recently published frame state. Safe to call from any thread.
+    AcousticsFrameStateRef GetFrameState() const;
+
+    virtual bool UpdateDistances(const TArray<FVector>& listenerLocations) override;
+    virtual bool QueryDistance(const FVector& lookDirection, float& outDistance, int32 listenerIndex = 0) override;
     virtual void UpdateLoadedRegion(
         const FVector& playerPosition, const FVector& tileSize, const bool forceUpdate,
         const bool unloadProbesOutsideTile, const bool blockOnCompletion) override;
+    virtual void UpdateLoadedRegions(const TArray<FVector>& listenerPositions, const FVector& tileSize) override;
 
     virtual FVector TritonPositionToWorld(const FVector& vec) const override;
     virtual FVector WorldPositionToTriton(const FVector& vec) const override;
@@ -180,15 +284,51 @@ private:
     bool m_AceFileLoaded;
     FVector m_LastLoadCenterPosition;
     FVector m_LastLoadTileSize;
+    // Listener positions at the time of the last multi-listener region load, and the regions that were loaded
+    TArray<FVector, TInlineAllocator<c_MaxAcousticsListeners>> m_LastLoadListenerPositions;
+    TArray<FBox, TInlineAllocator<c_MaxAcousticsListeners>> m_LoadedRegions;
     TUniquePtr<TritonRuntime::FTritonMemHook> m_TritonMemHook;
     TUniquePtr<TritonRuntime::FTritonLogHook> m_TritonLogHook;
     TUniquePtr<TritonRuntime::FTritonUnrealIOHook> m_TritonIOHook;
     TUniquePtr<TritonRuntime::FTritonAsyncTaskHook> m_TritonTaskHook;
     bool m_IsOutdoornessStale;
-    float m_CachedOutdoorness;
-    FAcousticsDesignParams m_GlobalDesign;
-    FTransform m_SpaceTransform;
-    FTransform m_InverseSpaceTransform;
+
+    // Set while a background ACE load owns the Triton instance. The game thread must not call into Triton
+    // until the load completes
+    bool m_IsAceFileLoading;
+    TFuture<bool> m_PendingAceLoad;
+    // Incremented on every load and unload, so completions of superseded loads can be ignored
+    uint32 m_AceLoadRequestId;
+
+    // Dynamic openings registered while an ACE load was in flight. Added to Triton when the load completes
+    struct DeferredDynamicOpening
+    {
+        class UAcousticsDynamicOpening* Opening;
+        FVector Center;
+        FVector Normal;
+        TArray<FVector> Vertices;
+    };
+    TArray<DeferredDynamicOpening> m_DeferredDynamicOpenings;
+    // Dynamic openings removed while an ACE load was in flight. Removed from Triton when the load completes
+    TArray<class UAcousticsDynamicOpening*> m_DeferredDynamicOpeningRemovals;
+
+    // Frame state being built up on the game thread for the current frame. Published in PostTick
+    AcousticsFrameState m_PendingFrameState;
+
+    // Last published frame state. Only the pointer swap is guarded, the snapshot itself is immutable
+    AcousticsFrameStateRef m_FrameState;
+    mutable FCriticalSection m_FrameStateLock;
+
+    // Triton only keeps a single distance map, which always belongs to the primary listener. For the other
+    // listeners, the map is sampled along a fixed set of directions when it is updated. Indexed by listener - 1
+    TArray<TArray<float>, TInlineAllocator<c_MaxAcousticsListeners>> m_SecondaryListenerDistances;
+    // Triton space location each listener's distances were last computed at, unset if they need computing.
+    // Distances are only recomputed for listeners that moved
+    TArray<TOptional<FVector>, TInlineAllocator<c_MaxAcousticsListeners>> m_DistanceListenerLocations;
+
+    // Dynamic openings whose attenuation changed since the last flush, with their latest dry/wet attenuation.
+    // Only accessed from the game thread
+    TMap<class UAcousticsDynamicOpening*, TPair<float, float>> m_DirtyDynamicOpenings;
 
     // Holds all async acoustic queries for each source before they've been returned to the caller
     // Key is the sourceID, value is the acoustic query results
@@ -204,6 +344,9 @@ private:
     // Keep track of how many background queries are queued or running
     volatile int32 m_NumRunningTasks;
 
+    // Decides how often each source gets a new background query, based on measured query load
+    FAcousticsQueryRateController m_QueryRateController;
+
 #if !UE_BUILD_SHIPPING
     bool m_IsEnabled;
     TUniquePtr<FProjectAcousticsDebugRender> m_DebugRenderer;
@@ -211,8 +354,13 @@ private:
 
     // Helpers
     bool GetAcousticParameters(
-        const FVector& sourceLocation, const FVector& listenerLocation, TritonAcousticParameters& params,
-        TritonDynamicOpeningInfo& outOpeningInfo, const TritonRuntime::InterpolationConfig& radiationDir, TritonRuntime::QueryDebugInfo* outDebugInfo = nullptr);
+        const FVector& sourceLocation, const FVector& listenerLocation, const AcousticsFrameState& frameState,
+        TritonAcousticParameters& params, TritonDynamicOpeningInfo& outOpeningInfo,
+        const TritonRuntime::InterpolationConfig& radiationDir, TritonRuntime::QueryDebugInfo* outDebugInfo = nullptr);
+    void PublishFrameState();
+    void OnAceFileLoaded(uint32 loadRequestId, bool success, const FString& filePath, TFunction<void(bool)> onLoaded);
+    void WaitForPendingAceLoad();
+    void FlushDeferredDynamicOpeningRemovals();
     void WaitForRunningTasks();
 };
 
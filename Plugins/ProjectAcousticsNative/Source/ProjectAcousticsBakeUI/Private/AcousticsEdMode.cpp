@@ -195,6 +195,12 @@ bool FAcousticsEdMode::TagGeometry(bool tag)
                 }
                 actor->Tags.Add(c_AcousticsGeometryTag);
             }
+
+            // Tags are changed directly, so no property change notification reaches the materials tab
+            if (m_materialsTab.IsValid())
+            {
+                m_materialsTab->MarkActorDirty(actor);
+            }
         }
     }
 
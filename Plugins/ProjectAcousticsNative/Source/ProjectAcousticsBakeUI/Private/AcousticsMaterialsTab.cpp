@@ -23,6 +23,9 @@
 #include "Misc/ConfigCacheIni.h"
 #include "EditorModeManager.h"
 #include "SourceControlHelpers.h"
+#include "Editor.h"                  // FEditorDelegates
+#include "Engine/World.h"            // FWorldDelegates
+#include "UObject/UObjectGlobals.h"  // FCoreUObjectDelegates
 // Added support for physical materials
 #include "PhysicalMaterials/PhysicalMaterial.h"
 // Added support for landscape layered materials
@@ -54,6 +57,16 @@ void SAcousticsMaterialsTab::Construct(const FArguments& InArgs)
     const FText column3HeaderText = LOCTEXT("AbsorptionColumnHeader", "Absorption");
 
     InitKnownMaterialsList();
+
+    // Keep the material list up to date incrementally instead of rescanning the level every time the tab is shown
+    m_ActorAddedHandle = GEngine->OnLevelActorAdded().AddSP(this, &SAcousticsMaterialsTab::OnLevelActorChanged);
+    m_ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddSP(this, &SAcousticsMaterialsTab::OnLevelActorChanged);
+    m_PropertyChangedHandle =
+        FCoreUObjectDelegates::OnObjectPropertyChanged.AddSP(this, &SAcousticsMaterialsTab::OnObjectPropertyChanged);
+    m_LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddSP(this, &SAcousticsMaterialsTab::OnLevelChanged);
+    m_LevelRemovedHandle = FWorldDelegates::LevelRemovedFromWorld.AddSP(this, &SAcousticsMaterialsTab::OnLevelChanged);
+    m_UndoRedoHandle = FEditorDelegates::PostUndoRedo.AddSP(this, &SAcousticsMaterialsTab::OnUndoRedo);
+
     UpdateUEMaterials();
     PublishMaterialLibrary();
 
@@ -136,51 +149,62 @@ void SAcousticsMaterialsTab::PublishMaterialLibrary()
     AcousticsSharedState::SetMaterialsLibrary(MoveTemp(materialLibrary));
 }
 
-void SAcousticsMaterialsTab::AddNewUEMaterialWithMigrationSupport(UMaterialInterface* curMaterial)
+SAcousticsMaterialsTab::~SAcousticsMaterialsTab()
+{
+    if (GEngine != nullptr)
+    {
+        GEngine->OnLevelActorAdded().Remove(m_ActorAddedHandle);
+        GEngine->OnLevelActorDeleted().Remove(m_ActorDeletedHandle);
+    }
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(m_PropertyChangedHandle);
+    FWorldDelegates::LevelAddedToWorld.Remove(m_LevelAddedHandle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(m_LevelRemovedHandle);
+    FEditorDelegates::PostUndoRedo.Remove(m_UndoRedoHandle);
+}
+
+FString SAcousticsMaterialsTab::MigrateLegacyMaterialUserData(UMaterialInterface* curMaterial)
 {
-    if (curMaterial != nullptr)
+    auto materialName = curMaterial->GetName();
+
+    // MIGRATION SUPPORT. We used to store material information in the material uasset
+    // Now we store it in the config file
+    // If the UAsset has our user data, move the material info into the config and then remove it
+    UAcousticsMaterialUserData* materialAssignment = curMaterial->GetAssetUserData<UAcousticsMaterialUserData>();
+    if (materialAssignment != nullptr && !materialAssignment->AssignedMaterialName.IsEmpty())
     {
-        // Instead of using unique ids to avoid duplicates, I simply check if the material item is in the list.
-        for (const TSharedPtr<MaterialItem>& Item : m_Items)
+        // Put the legacy data into the new config file. It is written out once the update finishes.
+        FString tritonMaterialAsString = FString::Printf(
+            TEXT("%s,%f"), *materialAssignment->AssignedMaterialName, materialAssignment->Absorptivity);
+
+        LoadMaterialsConfig();
+        m_ConfigMaterials.Add(materialName, tritonMaterialAsString);
+
+        FString ConfigFilePath;
+        FConfigFile* BaseProjectAcousticsConfigFile;
+        if (m_AcousticsEditMode->GetConfigFile(&BaseProjectAcousticsConfigFile, ConfigFilePath))
         {
-            if (Item->UEMaterialName == curMaterial->GetName())
-            {
-                return;
-            }
+            BaseProjectAcousticsConfigFile->SetString(
+                *c_ConfigSectionMaterials, *materialName, *tritonMaterialAsString);
+            m_ConfigDirty = true;
         }
 
-        // MIGRATION SUPPORT. We used to store material information in the material uasset
-        // Now we store it in the config file
-        // If the UAsset has our user data, read the material info out of there and then remove it
-        // Otherwise, continue on to AddNewUEMaterial
-        UAcousticsMaterialUserData* materialAssignment = curMaterial->GetAssetUserData<UAcousticsMaterialUserData>();
-        if (materialAssignment != nullptr && !materialAssignment->AssignedMaterialName.IsEmpty())
+        // The legacy assignment replaces anything resolved for this material before
+        auto existingItem = m_ItemsByName.FindRef(materialName);
+        if (existingItem.IsValid())
         {
-            // Update the materials list view
-            m_Items.Add(MakeShared<MaterialItem>(MaterialItem(
-                curMaterial->GetName(), materialAssignment->AssignedMaterialName, materialAssignment->Absorptivity)));
-            curMaterial->RemoveUserDataOfClass(UAcousticsMaterialUserData::StaticClass());
-            curMaterial->MarkPackageDirty();
-
-            // Put the legacy data into the new config file
-            FString tritonMaterialAsString = FString::Printf(
-                TEXT("%s,%f"), *materialAssignment->AssignedMaterialName, materialAssignment->Absorptivity);
-
-            FString ConfigFilePath;
-            FConfigFile* BaseProjectAcousticsConfigFile;
-            auto configLoaded = m_AcousticsEditMode->GetConfigFile(&BaseProjectAcousticsConfigFile, ConfigFilePath);
-            if (configLoaded)
-            {
-                BaseProjectAcousticsConfigFile->SetString(
-                    *c_ConfigSectionMaterials, *curMaterial->GetName(), *tritonMaterialAsString);
-                BaseProjectAcousticsConfigFile->Write(ConfigFilePath);
-            }
+            existingItem->AcousticMaterialName = materialAssignment->AssignedMaterialName;
+            existingItem->Absorption = materialAssignment->Absorptivity;
         }
         else
         {
-            AddNewUEMaterial(curMaterial->GetName());
+            m_ItemsByName.Remove(materialName);
         }
+
+        curMaterial->RemoveUserDataOfClass(UAcousticsMaterialUserData::StaticClass());
+        curMaterial->MarkPackageDirty();
     }
+
+    return materialName;
 }
 
 void SAcousticsMaterialsTab::UpdateUEMaterials()
@@ -194,144 +218,259 @@ void SAcousticsMaterialsTab::UpdateUEMaterials()
     }
 
     UWorld* currentWorld = GEditor->GetEditorWorldContext().World();
+    if (currentWorld != m_ScannedWorld.Get())
+    {
+        m_NeedsFullScan = true;
+    }
 
-    m_Items.Empty();
-    UMaterial* defaultMat = UMaterial::GetDefaultMaterial(MD_Surface);
-    AddNewUEMaterial(defaultMat->GetName());
+    if (!m_NeedsFullScan && m_DirtyActors.Num() == 0)
+    {
+        // Nothing changed since the last update
+        return;
+    }
 
-    for (FActorIterator ActorIter(currentWorld); ActorIter; ++ActorIter)
+    TArray<FString> materialNames;
+    if (m_NeedsFullScan)
     {
-        AActor* curActor = *ActorIter;
+        m_ActorMaterialNames.Empty();
+        m_MaterialRefCounts.Empty();
 
-        // TODO - Add toggle to show all materials
-        if (curActor == nullptr)
+        for (FActorIterator ActorIter(currentWorld); ActorIter; ++ActorIter)
         {
-            continue;
-        }
+            AActor* curActor = *ActorIter;
 
-        // Check for acoustic material override volumes here. They won't be tagged, but should always be included
-        if (curActor->IsA<AAcousticsProbeVolume>())
-        {
-            AAcousticsProbeVolume* volume = Cast<AAcousticsProbeVolume>(curActor);
-            if (volume->VolumeType == AcousticsVolumeType::MaterialOverride)
+            // TODO - Add toggle to show all materials
+            if (curActor == nullptr)
             {
-                // Using the override material prefix.
-                AddNewUEMaterial((AAcousticsProbeVolume::OverrideMaterialNamePrefix + volume->MaterialName));
+                continue;
             }
-            // Check for acoustic remap volumes. They won't be tagged, but should always be included.
-            // Add a material item for every remap defined in the volume.
-            else if (volume->VolumeType == AcousticsVolumeType::MaterialRemap)
+
+            materialNames.Reset();
+            CollectActorMaterialNames(curActor, materialNames);
+            SetActorMaterialNames(curActor, MoveTemp(materialNames));
+        }
+
+        m_ScannedWorld = currentWorld;
+        m_NeedsFullScan = false;
+    }
+    else
+    {
+        for (const TWeakObjectPtr<AActor>& dirtyActor : m_DirtyActors)
+        {
+            // Deleted actors are no longer valid, drop whatever they contributed
+            AActor* curActor = dirtyActor.Get();
+            if (!IsValid(curActor) || curActor->GetWorld() != currentWorld)
             {
-                for (const TPair<FString, FString>& Remap : volume->MaterialRemapping)
-                {
-                    // Using the remap material prefix.
-                    AddNewUEMaterial((AAcousticsProbeVolume::RemapMaterialNamePrefix + Remap.Value));
-                }
+                RemoveActorMaterialNames(dirtyActor);
+                continue;
             }
+
+            materialNames.Reset();
+            CollectActorMaterialNames(curActor, materialNames);
+            SetActorMaterialNames(curActor, MoveTemp(materialNames));
         }
+    }
+    m_DirtyActors.Empty();
+
+    RebuildItemsList();
+    FlushMaterialsConfig();
+}
+
+void SAcousticsMaterialsTab::MarkActorDirty(AActor* actor)
+{
+    if (actor != nullptr && !actor->IsTemplate())
+    {
+        m_DirtyActors.Add(actor);
+    }
+}
 
-        if (!curActor->Tags.Contains(c_AcousticsGeometryTag))
+void SAcousticsMaterialsTab::CollectActorMaterialNames(AActor* curActor, TArray<FString>& materialNames)
+{
+    // Check for acoustic material override volumes here. They won't be tagged, but should always be included
+    if (curActor->IsA<AAcousticsProbeVolume>())
+    {
+        AAcousticsProbeVolume* volume = Cast<AAcousticsProbeVolume>(curActor);
+        if (volume->VolumeType == AcousticsVolumeType::MaterialOverride)
         {
-            continue;
+            // Using the override material prefix.
+            materialNames.AddUnique(AAcousticsProbeVolume::OverrideMaterialNamePrefix + volume->MaterialName);
         }
-
-        // Instead of checking whether the actor is a StaticMeshActor,
-        // loop through its components and check if it has any static mesh components.
-        // Add the materials of every static mesh component to the materials list.
-        TArray<UMaterialInterface*> materials;
-        TArray<UStaticMeshComponent*> staticMeshComponents;
-        curActor->GetComponents<UStaticMeshComponent>(staticMeshComponents, true);
-        for (UStaticMeshComponent* meshComponent : staticMeshComponents)
+        // Check for acoustic remap volumes. They won't be tagged, but should always be included.
+        // Add a material item for every remap defined in the volume.
+        else if (volume->VolumeType == AcousticsVolumeType::MaterialRemap)
         {
-            if (meshComponent && meshComponent->Mobility == EComponentMobility::Static)
+            for (const TPair<FString, FString>& Remap : volume->MaterialRemapping)
             {
-                // Add the physical material override if it exists.
-                UPhysicalMaterial* meshPhysMaterial = meshComponent->BodyInstance.GetSimplePhysicalMaterial();
-                if (m_AcousticsEditMode->ShouldUsePhysicalMaterial(meshPhysMaterial))
-                {
-                    AddNewUEMaterial(meshPhysMaterial->GetName());
-                }
-                else
-                {
-                    // This gets the override materials or the original static mesh materials as appropriate.
-                    materials.Append(meshComponent->GetMaterials());
-                }
+                // Using the remap material prefix.
+                materialNames.AddUnique(AAcousticsProbeVolume::RemapMaterialNamePrefix + Remap.Value);
             }
         }
+    }
 
-        for (UMaterialInterface* curMaterial : materials)
+    if (!curActor->Tags.Contains(c_AcousticsGeometryTag))
+    {
+        return;
+    }
+
+    // Instead of checking whether the actor is a StaticMeshActor,
+    // loop through its components and check if it has any static mesh components.
+    // Add the materials of every static mesh component to the materials list.
+    TArray<UMaterialInterface*> materials;
+    TArray<UStaticMeshComponent*> staticMeshComponents;
+    curActor->GetComponents<UStaticMeshComponent>(staticMeshComponents, true);
+    for (UStaticMeshComponent* meshComponent : staticMeshComponents)
+    {
+        if (meshComponent && meshComponent->Mobility == EComponentMobility::Static)
         {
-            if (curMaterial != nullptr)
+            // Add the physical material override if it exists.
+            UPhysicalMaterial* meshPhysMaterial = meshComponent->BodyInstance.GetSimplePhysicalMaterial();
+            if (m_AcousticsEditMode->ShouldUsePhysicalMaterial(meshPhysMaterial))
             {
-                // If we have not added physical material above,
-                // add the physical material associated with the UE material if it exists.
-                UPhysicalMaterial* curPhysMaterial = curMaterial->GetPhysicalMaterial();
-                if (m_AcousticsEditMode->ShouldUsePhysicalMaterial(curPhysMaterial))
-                {
-                    AddNewUEMaterial(curPhysMaterial->GetName());
-                }
-                else
-                {
-                    AddNewUEMaterialWithMigrationSupport(curMaterial);
-                }
+                materialNames.AddUnique(meshPhysMaterial->GetName());
+            }
+            else
+            {
+                // This gets the override materials or the original static mesh materials as appropriate.
+                materials.Append(meshComponent->GetMaterials());
             }
         }
+    }
 
-        if (curActor->IsA<ALandscapeProxy>()) // ALandscape derives from ALandscapeProxy
+    for (UMaterialInterface* curMaterial : materials)
+    {
+        if (curMaterial != nullptr)
         {
-            auto landscape = Cast<ALandscapeProxy>(curActor);
-            // Add the landscape physical material if it exists. This acts like override for the whole landscape.
-            UPhysicalMaterial* curPhysMaterial = landscape->BodyInstance.GetSimplePhysicalMaterial();
+            // If we have not added physical material above,
+            // add the physical material associated with the UE material if it exists.
+            UPhysicalMaterial* curPhysMaterial = curMaterial->GetPhysicalMaterial();
             if (m_AcousticsEditMode->ShouldUsePhysicalMaterial(curPhysMaterial))
             {
-                AddNewUEMaterial(curPhysMaterial->GetName());
+                materialNames.AddUnique(curPhysMaterial->GetName());
             }
             else
             {
-                // Add the layers or their associated physical material to the materials tab list.
-                TArray<FLandscapeEditorLayerSettings> EditorLayerSettings = landscape->EditorLayerSettings;
-                if (EditorLayerSettings.Num())
+                materialNames.AddUnique(MigrateLegacyMaterialUserData(curMaterial));
+            }
+        }
+    }
+
+    if (curActor->IsA<ALandscapeProxy>()) // ALandscape derives from ALandscapeProxy
+    {
+        auto landscape = Cast<ALandscapeProxy>(curActor);
+        // Add the landscape physical material if it exists. This acts like override for the whole landscape.
+        UPhysicalMaterial* curPhysMaterial = landscape->BodyInstance.GetSimplePhysicalMaterial();
+        if (m_AcousticsEditMode->ShouldUsePhysicalMaterial(curPhysMaterial))
+        {
+            materialNames.AddUnique(curPhysMaterial->GetName());
+        }
+        else
+        {
+            // Add the layers or their associated physical material to the materials tab list.
+            const TArray<FLandscapeEditorLayerSettings>& EditorLayerSettings = landscape->EditorLayerSettings;
+            if (EditorLayerSettings.Num())
+            {
+                for (const FLandscapeEditorLayerSettings& LayerSettings : EditorLayerSettings)
                 {
-                    for (const FLandscapeEditorLayerSettings& LayerSettings : EditorLayerSettings)
+                    ULandscapeLayerInfoObject* LayerInfo = LayerSettings.LayerInfoObj;
+                    if (LayerInfo != nullptr)
                     {
-                        ULandscapeLayerInfoObject* LayerInfo = LayerSettings.LayerInfoObj;
-                        if (LayerInfo != nullptr)
+                        const UPhysicalMaterial* layerPhysMaterial = LayerInfo->PhysMaterial;
+                        if (m_AcousticsEditMode->ShouldUsePhysicalMaterial(layerPhysMaterial))
+                        {
+                            materialNames.AddUnique(layerPhysMaterial->GetName());
+                        }
+                        else
                         {
-                            const UPhysicalMaterial* layerPhysMaterial = LayerInfo->PhysMaterial;
-                            if (m_AcousticsEditMode->ShouldUsePhysicalMaterial(layerPhysMaterial))
-                            {
-                                AddNewUEMaterial(layerPhysMaterial->GetName());
-                            }
-                            else
-                            {
-                                AddNewUEMaterial(LayerInfo->GetName());
-                            }
+                            materialNames.AddUnique(LayerInfo->GetName());
                         }
                     }
                 }
-                else
+            }
+            else
+            {
+                UMaterialInterface* curMaterial = landscape->GetLandscapeMaterial();
+                if (curMaterial != nullptr)
                 {
-                    UMaterialInterface* curMaterial = landscape->GetLandscapeMaterial();
-                    if (curMaterial != nullptr)
+                    // Add the associated physical material if it exists for the material used in landscape.
+                    curPhysMaterial = curMaterial->GetPhysicalMaterial();
+                    if (m_AcousticsEditMode->ShouldUsePhysicalMaterial(curPhysMaterial))
                     {
-                        // Add the associated physical material if it exists for the material used in landscape.
-                        curPhysMaterial = curMaterial->GetPhysicalMaterial();
-                        if (m_AcousticsEditMode->ShouldUsePhysicalMaterial(curPhysMaterial))
-                        {
-                            AddNewUEMaterial(curPhysMaterial->GetName());
-                        }
-                        else
-                        {
-                            AddNewUEMaterialWithMigrationSupport(curMaterial);
-                        }
+                        materialNames.AddUnique(curPhysMaterial->GetName());
+                    }
+                    else
+                    {
+                        materialNames.AddUnique(MigrateLegacyMaterialUserData(curMaterial));
                     }
                 }
             }
         }
+    }
+
+    // Ignore all other actor types
+}
+
+void SAcousticsMaterialsTab::SetActorMaterialNames(AActor* curActor, TArray<FString>&& materialNames)
+{
+    RemoveActorMaterialNames(curActor);
+
+    if (materialNames.Num() == 0)
+    {
+        return;
+    }
+
+    for (const FString& materialName : materialNames)
+    {
+        m_MaterialRefCounts.FindOrAdd(materialName)++;
+        FindOrAddMaterialItem(materialName);
+    }
+    m_ActorMaterialNames.Add(curActor, MoveTemp(materialNames));
+}
+
+void SAcousticsMaterialsTab::RemoveActorMaterialNames(const TWeakObjectPtr<AActor>& curActor)
+{
+    TArray<FString> oldMaterialNames;
+    if (!m_ActorMaterialNames.RemoveAndCopyValue(curActor, oldMaterialNames))
+    {
+        return;
+    }
+
+    for (const FString& materialName : oldMaterialNames)
+    {
+        int32* refCount = m_MaterialRefCounts.Find(materialName);
+        if (refCount != nullptr && --(*refCount) <= 0)
+        {
+            m_MaterialRefCounts.Remove(materialName);
+        }
+    }
+}
+
+void SAcousticsMaterialsTab::RebuildItemsList()
+{
+    m_Items.Reset();
+
+    // The default material always comes first, even if nothing in the level uses it
+    UMaterial* defaultMat = UMaterial::GetDefaultMaterial(MD_Surface);
+    auto defaultItem = FindOrAddMaterialItem(defaultMat->GetName());
+    if (defaultItem.IsValid())
+    {
+        m_Items.Add(defaultItem);
+    }
 
-        // Ignore all other actor types
+    TArray<TSharedPtr<MaterialItem>> usedItems;
+    for (const TPair<FString, int32>& refCount : m_MaterialRefCounts)
+    {
+        auto item = m_ItemsByName.FindRef(refCount.Key);
+        if (item.IsValid() && item != defaultItem)
+        {
+            usedItems.Add(item);
+        }
     }
 
+    // The ref count map has no stable order, so sort by name to keep rows from jumping around between rebuilds
+    usedItems.Sort([](const TSharedPtr<MaterialItem>& a, const TSharedPtr<MaterialItem>& b)
+                   { return a->UEMaterialName < b->UEMaterialName; });
+    m_Items.Append(usedItems);
+
     // If the listview has already been created, then force it to update.
     if (m_ListView.Get() != nullptr)
     {
@@ -339,45 +478,44 @@ void SAcousticsMaterialsTab::UpdateUEMaterials()
     }
 }
 
-// Instead of using unique ids to avoid duplicates, simply check if the material item has already been added.
-void SAcousticsMaterialsTab::AddNewUEMaterial(FString materialName)
+TSharedPtr<MaterialItem> SAcousticsMaterialsTab::FindOrAddMaterialItem(const FString& materialName)
 {
-    for (const TSharedPtr<MaterialItem>& Item : m_Items)
+    // Items are kept for the lifetime of the tab, so a material is only resolved once
+    if (const TSharedPtr<MaterialItem>* existingItem = m_ItemsByName.Find(materialName))
     {
-        if (Item->UEMaterialName == materialName)
-        {
-            return;
-        }
+        return *existingItem;
     }
 
-    {
-        FConfigFile* BaseProjectAcousticsConfigFile;
-        FString ConfigFilePath;
-        auto configLoaded = m_AcousticsEditMode->GetConfigFile(&BaseProjectAcousticsConfigFile, ConfigFilePath);
+    LoadMaterialsConfig();
 
-        FString serializedTritonInfo;
-        if (configLoaded &&
-            BaseProjectAcousticsConfigFile->GetString(*c_ConfigSectionMaterials, *materialName, serializedTritonInfo))
+    TSharedPtr<MaterialItem> newItem;
+    if (const FString* serializedTritonInfo = m_ConfigMaterials.Find(materialName))
+    {
+        TArray<FString> tritonInfoValues;
+        if (serializedTritonInfo->ParseIntoArray(tritonInfoValues, TEXT(","), true) == 2)
         {
-            TArray<FString> tritonInfoValues;
-            if (serializedTritonInfo.ParseIntoArray(tritonInfoValues, TEXT(","), true) == 2)
-            {
-                TritonAcousticMaterial acousticMaterial;
-                strncpy_s(
-                    acousticMaterial.Name,
-                    TRITON_MAX_NAME_LENGTH,
-                    TCHAR_TO_ANSI(*(tritonInfoValues[0])),
-                    tritonInfoValues[0].Len());
-                acousticMaterial.Absorptivity = FCString::Atof(*tritonInfoValues[1]);
-                m_Items.Add(MakeShared<MaterialItem>(
-                    MaterialItem(materialName, acousticMaterial.Name, acousticMaterial.Absorptivity)));
-            }
-            else
+            TritonAcousticMaterial acousticMaterial;
+            strncpy_s(
+                acousticMaterial.Name,
+                TRITON_MAX_NAME_LENGTH,
+                TCHAR_TO_ANSI(*(tritonInfoValues[0])),
+                tritonInfoValues[0].Len());
+            acousticMaterial.Absorptivity = FCString::Atof(*tritonInfoValues[1]);
+            newItem = MakeShared<MaterialItem>(
+                MaterialItem(materialName, acousticMaterial.Name, acousticMaterial.Absorptivity));
+        }
+        else
+        {
+            UE_LOG(LogAcoustics, Error, TEXT("Deserialization error with UE material name %s."), *materialName);
+            // If the serialization data is bad, clear it out
+            // Remove the invalid serialized material data from the base ini file instead of the generated config
+            // file.
+            m_ConfigMaterials.Remove(materialName);
+
+            FConfigFile* BaseProjectAcousticsConfigFile;
+            FString ConfigFilePath;
+            if (m_AcousticsEditMode->GetConfigFile(&BaseProjectAcousticsConfigFile, ConfigFilePath))
             {
-                UE_LOG(LogAcoustics, Error, TEXT("Deserialization error with UE material name %s."), *materialName);
-                // If the serialization data is bad, clear it out
-                // Remove the invalid serialized material data from the base ini file instead of the generated config
-                // file.
                 FConfigSection* MaterialsSection = BaseProjectAcousticsConfigFile->Find(c_ConfigSectionMaterials);
                 if (MaterialsSection)
                 {
@@ -387,35 +525,124 @@ void SAcousticsMaterialsTab::AddNewUEMaterial(FString materialName)
                         BaseProjectAcousticsConfigFile->Remove(c_ConfigSectionMaterials);
                     }
                     BaseProjectAcousticsConfigFile->Dirty = true;
+                    m_ConfigDirty = true;
                 }
-                if (FAcousticsEdMode::IsSourceControlAvailable())
-                {
-                    USourceControlHelpers::CheckOutOrAddFile(ConfigFilePath);
-                }
-                BaseProjectAcousticsConfigFile->Write(ConfigFilePath);
             }
         }
+    }
+
+    if (!newItem.IsValid())
+    {
+        // Deserialization failed -- create a new material from the material name
+        auto knownMaterialsLibrary = AcousticsSharedState::GetKnownMaterialsLibrary();
+        TritonAcousticMaterial acousticMaterial;
+        TritonMaterialCode materialCode;
+        // No assignment was saved in the config for this material.
+        // If the call to GuessMaterialInfoFromGeneralName fails, we just write an error to the log and skip it.
+        if (knownMaterialsLibrary->GuessMaterialInfoFromGeneralName(materialName, acousticMaterial, materialCode))
+        {
+            newItem = MakeShared<MaterialItem>(
+                MaterialItem(materialName, acousticMaterial.Name, acousticMaterial.Absorptivity));
+        }
         else
         {
-            // Deserialization failed -- create a new material from the material name
-            auto knownMaterialsLibrary = AcousticsSharedState::GetKnownMaterialsLibrary();
-            TritonAcousticMaterial acousticMaterial;
-            TritonMaterialCode materialCode;
-            // No assignment was saved in the config for this material.
-            // If the call to GuessMaterialInfoFromGeneralName fails, we just write an error to the log and skip it.
-            if (knownMaterialsLibrary->GuessMaterialInfoFromGeneralName(materialName, acousticMaterial, materialCode))
-            {
-                m_Items.Add(MakeShared<MaterialItem>(
-                    MaterialItem(materialName, acousticMaterial.Name, acousticMaterial.Absorptivity)));
-            }
-            else
-            {
-                UE_LOG(LogAcoustics, Error, TEXT("Attempt to match UE material name %s failed."), *materialName);
-            }
+            UE_LOG(LogAcoustics, Error, TEXT("Attempt to match UE material name %s failed."), *materialName);
+        }
+    }
+
+    // Unmatched materials are stored as null so the lookup isn't repeated on every update
+    m_ItemsByName.Add(materialName, newItem);
+    return newItem;
+}
+
+void SAcousticsMaterialsTab::LoadMaterialsConfig()
+{
+    if (m_ConfigMaterialsLoaded)
+    {
+        return;
+    }
+
+    FConfigFile* BaseProjectAcousticsConfigFile;
+    FString ConfigFilePath;
+    if (!m_AcousticsEditMode->GetConfigFile(&BaseProjectAcousticsConfigFile, ConfigFilePath))
+    {
+        return;
+    }
+
+    if (const FConfigSection* MaterialsSection = BaseProjectAcousticsConfigFile->Find(c_ConfigSectionMaterials))
+    {
+        m_ConfigMaterials.Reserve(MaterialsSection->Num());
+        for (const auto& entry : *MaterialsSection)
+        {
+            m_ConfigMaterials.Add(entry.Key.ToString(), entry.Value.GetValue());
+        }
+    }
+    m_ConfigMaterialsLoaded = true;
+}
+
+void SAcousticsMaterialsTab::FlushMaterialsConfig()
+{
+    if (!m_ConfigDirty)
+    {
+        return;
+    }
+
+    FConfigFile* BaseProjectAcousticsConfigFile;
+    FString ConfigFilePath;
+    if (m_AcousticsEditMode->GetConfigFile(&BaseProjectAcousticsConfigFile, ConfigFilePath))
+    {
+        if (FAcousticsEdMode::IsSourceControlAvailable())
+        {
+            USourceControlHelpers::CheckOutOrAddFile(ConfigFilePath);
         }
+        BaseProjectAcousticsConfigFile->Write(ConfigFilePath);
+    }
+    m_ConfigDirty = false;
+}
+
+void SAcousticsMaterialsTab::OnLevelActorChanged(AActor* actor)
+{
+    MarkActorDirty(actor);
+}
+
+void SAcousticsMaterialsTab::OnObjectPropertyChanged(UObject* object, FPropertyChangedEvent& propertyChangedEvent)
+{
+    if (object == nullptr)
+    {
+        return;
+    }
+
+    if (AActor* actor = Cast<AActor>(object))
+    {
+        MarkActorDirty(actor);
+    }
+    else if (UActorComponent* component = Cast<UActorComponent>(object))
+    {
+        MarkActorDirty(component->GetOwner());
+    }
+    else if (
+        object->IsA<UMaterialInterface>() || object->IsA<UPhysicalMaterial>() ||
+        object->IsA<ULandscapeLayerInfoObject>())
+    {
+        // Assets can be shared by any number of actors, so look at the whole level again
+        m_NeedsFullScan = true;
+    }
+}
+
+void SAcousticsMaterialsTab::OnLevelChanged(ULevel* level, UWorld* world)
+{
+    if (world == m_ScannedWorld.Get())
+    {
+        m_NeedsFullScan = true;
     }
 }
 
+void SAcousticsMaterialsTab::OnUndoRedo()
+{
+    // Undo can bring back or remove actors without any of the other notifications firing
+    m_NeedsFullScan = true;
+}
+
 void SAcousticsMaterialsTab::InitKnownMaterialsList()
 {
     const AcousticsMaterialLibrary* knownMaterialsLibrary = AcousticsSharedState::GetKnownMaterialsLibrary();
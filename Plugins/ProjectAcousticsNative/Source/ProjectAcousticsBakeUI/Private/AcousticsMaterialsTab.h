@@ -10,6 +10,10 @@
 // Forward declaration used
 // instead of an include to avoid cyclical dependencies.
 class FAcousticsEdMode;
+class AActor;
+class ULevel;
+class UWorld;
+class UMaterialInterface;
 
 class SAcousticsMaterialsTab : public SCompoundWidget
 {
@@ -21,10 +25,20 @@ public:
 
     /** SCompoundWidget functions */
     void Construct(const FArguments& InArgs);
+    virtual ~SAcousticsMaterialsTab();
 
     void PublishMaterialLibrary();
+    // Brings the material list up to date. Only actors that changed since the last update are rescanned.
     void UpdateUEMaterials();
 
+    // Rescan a single actor on the next update, e.g. after its acoustics tags changed
+    void MarkActorDirty(AActor* actor);
+    // Rescan the whole level on the next update, e.g. after the physical materials setting changed
+    void InvalidateUEMaterials()
+    {
+        m_NeedsFullScan = true;
+    }
+
     static FName ColumnNameMaterial;
     static FName ColumnNameAcoustics;
     static FName ColumnNameAbsorption;
@@ -39,10 +53,23 @@ private:
     TSharedRef<ITableRow>
     OnGenerateRowForMaterialList(TSharedPtr<MaterialItem> InItem, const TSharedRef<STableViewBase>& OwnerTable);
     void OnRowSelectionChanged(TSharedPtr<MaterialItem> InItem, ESelectInfo::Type SelectInfo);
-    void AddNewUEMaterial(FString materialName);
-    void AddNewUEMaterialWithMigrationSupport(UMaterialInterface* curMaterial);
+    void CollectActorMaterialNames(AActor* curActor, TArray<FString>& materialNames);
+    void SetActorMaterialNames(AActor* curActor, TArray<FString>&& materialNames);
+    void RemoveActorMaterialNames(const TWeakObjectPtr<AActor>& curActor);
+    void RebuildItemsList();
+    TSharedPtr<MaterialItem> FindOrAddMaterialItem(const FString& materialName);
+    FString MigrateLegacyMaterialUserData(UMaterialInterface* curMaterial);
     void InitKnownMaterialsList();
 
+    // Config section is parsed once, changes are written back in one batch at the end of an update
+    void LoadMaterialsConfig();
+    void FlushMaterialsConfig();
+
+    void OnLevelActorChanged(AActor* actor);
+    void OnObjectPropertyChanged(UObject* object, struct FPropertyChangedEvent& propertyChangedEvent);
+    void OnLevelChanged(ULevel* level, UWorld* world);
+    void OnUndoRedo();
+
     EColumnSortMode::Type GetColumnSortMode(const FName ColumnId) const;
     void OnColumnNameSortModeChanged(const EColumnSortPriority::Type SortPriority, const FName& ColumnId, const EColumnSortMode::Type InSortMode);
 
@@ -50,6 +77,27 @@ private:
     TArray<TritonAcousticMaterial> m_KnownMaterials;
     TArray<TritonMaterialCode> m_KnownMaterialCodes;
     TArray<TSharedPtr<MaterialItem>> m_Items;
+    // Every material resolved so far, including ones no longer used in the level, so user edits survive rescans.
+    // Null entries are materials that could not be matched to an acoustic material.
+    TMap<FString, TSharedPtr<MaterialItem>> m_ItemsByName;
+    // Material names contributed by each scanned actor, and how many actors use each name
+    TMap<TWeakObjectPtr<AActor>, TArray<FString>> m_ActorMaterialNames;
+    TMap<FString, int32> m_MaterialRefCounts;
+    TSet<TWeakObjectPtr<AActor>> m_DirtyActors;
+    TWeakObjectPtr<UWorld> m_ScannedWorld;
+    bool m_NeedsFullScan = true;
+
+    // Serialized "AcousticMaterial,Absorption" values from the materials config section
+    TMap<FString, FString> m_ConfigMaterials;
+    bool m_ConfigMaterialsLoaded = false;
+    bool m_ConfigDirty = false;
+
+    FDelegateHandle m_ActorAddedHandle;
+    FDelegateHandle m_ActorDeletedHandle;
+    FDelegateHandle m_PropertyChangedHandle;
+    FDelegateHandle m_LevelAddedHandle;
+    FDelegateHandle m_LevelRemovedHandle;
+    FDelegateHandle m_UndoRedoHandle;
     TSharedPtr<SListView<TSharedPtr<MaterialItem>>> m_ListView;
     EColumnSortMode::Type SortMode;
     FAcousticsEdMode* m_AcousticsEditMode;
@@ -22,6 +22,11 @@ bool AcousticMesh::Add(
     ATKVectorD* vertices, int vertexCount, TritonAcousticMeshTriangleInformation* triangleInfos, int trianglesCount,
     MeshType type)
 {
+    if (m_MirrorMesh.IsValid() && !m_MirrorMesh->Add(vertices, vertexCount, triangleInfos, trianglesCount, type))
+    {
+        return false;
+    }
+
     // Remember if navigation mesh is added
     if (type == MeshTypeNavigation)
     {
@@ -30,6 +35,23 @@ bool AcousticMesh::Add(
     else if (type == MeshTypeGeometry)
     {
         m_HasGeometryMesh = true;
+
+        if (m_GeometrySimplificationError > 0)
+        {
+            const auto vertexOffset = m_PendingGeometryVertices.Num();
+            m_PendingGeometryVertices.Append(vertices, vertexCount);
+            m_PendingGeometryTriangles.Reserve(m_PendingGeometryTriangles.Num() + trianglesCount);
+            for (auto i = 0; i < trianglesCount; i++)
+            {
+                auto triangle = triangleInfos[i];
+                triangle.Indices = ATKVectorI{
+                    triangle.Indices.x + vertexOffset,
+                    triangle.Indices.y + vertexOffset,
+                    triangle.Indices.z + vertexOffset};
+                m_PendingGeometryTriangles.Add(triangle);
+            }
+            return true;
+        }
     }
 
     return TritonPreprocessor_AcousticMesh_Add(m_Handle, vertices, vertexCount, triangleInfos, trianglesCount, type);
@@ -39,6 +61,12 @@ bool AcousticMesh::AddProbeSpacingVolume(
     ATKVectorD* vertices, int vertexCount, TritonAcousticMeshTriangleInformation* triangleInfos, int trianglesCount,
     float spacing)
 {
+    if (m_MirrorMesh.IsValid() &&
+        !m_MirrorMesh->AddProbeSpacingVolume(vertices, vertexCount, triangleInfos, trianglesCount, spacing))
+    {
+        return false;
+    }
+
     // Spacing value in UE is in centimeters, but triton operates in meters
     return TritonPreprocessor_AcousticMesh_AddProbeSpacingVolume(
         m_Handle, vertices, vertexCount, triangleInfos, trianglesCount, spacing / 100);
@@ -46,9 +74,45 @@ bool AcousticMesh::AddProbeSpacingVolume(
 
 bool AcousticMesh::AddPinnedProbe(ATKVectorD probeLocation)
 {
+    if (m_MirrorMesh.IsValid() && !m_MirrorMesh->AddPinnedProbe(probeLocation))
+    {
+        return false;
+    }
     return TritonPreprocessor_AcousticMesh_AddPinnedProbe(m_Handle, probeLocation);
 }
 
+bool AcousticMesh::FinalizeGeometry(AcousticsMeshSimplificationStats* stats)
+{
+    if (m_MirrorMesh.IsValid() && !m_MirrorMesh->FinalizeGeometry(stats))
+    {
+        return false;
+    }
+
+    if (m_PendingGeometryTriangles.Num() == 0)
+    {
+        return true;
+    }
+
+    auto simplificationStats = AcousticsMeshSimplifier::Simplify(
+        m_PendingGeometryVertices, m_PendingGeometryTriangles, m_GeometrySimplificationError);
+    if (stats != nullptr)
+    {
+        *stats = simplificationStats;
+    }
+
+    auto result = TritonPreprocessor_AcousticMesh_Add(
+        m_Handle,
+        m_PendingGeometryVertices.GetData(),
+        m_PendingGeometryVertices.Num(),
+        m_PendingGeometryTriangles.GetData(),
+        m_PendingGeometryTriangles.Num(),
+        MeshTypeGeometry);
+
+    m_PendingGeometryVertices.Empty();
+    m_PendingGeometryTriangles.Empty();
+    return result;
+}
+
 const TritonObject& AcousticMesh::GetHandle() const
 {
     return m_Handle;
@@ -3,8 +3,10 @@
 
 #pragma once
 #include "TritonPreprocessorApi.h"
+#include "AcousticsMeshSimplifier.h"
 // Add include for non-unity build
 #include "Templates/UniquePtr.h"
+#include "Templates/SharedPointer.h"
 
 // C++ wrappers for Triton Preprocessor types
 class AcousticMesh final
@@ -19,6 +21,19 @@ public:
         ATKVectorD* vertices, int vertexCount, TritonAcousticMeshTriangleInformation* triangleInfos, int trianglesCount,
         float spacing);
     bool AddPinnedProbe(ATKVectorD probeLocation);
+    // When maxError is positive, geometry added afterwards is held back and simplified in FinalizeGeometry
+    void SetGeometrySimplificationError(double maxError)
+    {
+        m_GeometrySimplificationError = maxError;
+    }
+    // Everything added afterwards is also added to mirror, so the same scene can be processed with different settings
+    void SetMirrorMesh(TSharedPtr<AcousticMesh> mirror)
+    {
+        m_MirrorMesh = mirror;
+    }
+    // Simplifies any held back geometry, here and in the mirror, and passes it to Triton.
+    // Call once all geometry has been added.
+    bool FinalizeGeometry(AcousticsMeshSimplificationStats* stats = nullptr);
     const TritonObject& GetHandle() const;
     bool HasNavigationMesh() const
     {
@@ -30,7 +45,8 @@ public:
     }
 
 private:
-    AcousticMesh() : m_Handle(nullptr), m_HasNavigationMesh(false), m_HasGeometryMesh(false)
+    AcousticMesh()
+        : m_Handle(nullptr), m_HasNavigationMesh(false), m_HasGeometryMesh(false), m_GeometrySimplificationError(0)
     {
     }
 
@@ -40,4 +56,9 @@ private:
     TritonObject m_Handle;
     bool m_HasNavigationMesh;
     bool m_HasGeometryMesh;
+    double m_GeometrySimplificationError;
+    TSharedPtr<AcousticMesh> m_MirrorMesh;
+    // All geometry meshes merged into one, so vertices can be welded across meshes before simplifying
+    TArray<ATKVectorD> m_PendingGeometryVertices;
+    TArray<TritonAcousticMeshTriangleInformation> m_PendingGeometryTriangles;
 };
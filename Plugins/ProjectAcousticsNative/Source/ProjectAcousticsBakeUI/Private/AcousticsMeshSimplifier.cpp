@@ -0,0 +1,520 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "AcousticsMeshSimplifier.h"
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Math/Vector.h"
+
+namespace
+{
+// Collapses that tilt a neighboring triangle further than this (cosine) are rejected, this also catches flips
+const double c_MinNormalDotAfterCollapse = 0.2;
+
+FVector3d ToVector(const ATKVectorD& v)
+{
+    return FVector3d(v.x, v.y, v.z);
+}
+
+// Symmetric 4x4 matrix summing squared distances to a set of planes
+struct Quadric
+{
+    double A2 = 0, AB = 0, AC = 0, AD = 0, B2 = 0, BC = 0, BD = 0, C2 = 0, CD = 0, D2 = 0;
+
+    static Quadric FromPlane(const FVector3d& normal, const FVector3d& pointOnPlane)
+    {
+        const auto a = normal.X;
+        const auto b = normal.Y;
+        const auto c = normal.Z;
+        const auto d = -FVector3d::DotProduct(normal, pointOnPlane);
+
+        Quadric q;
+        q.A2 = a * a;
+        q.AB = a * b;
+        q.AC = a * c;
+        q.AD = a * d;
+        q.B2 = b * b;
+        q.BC = b * c;
+        q.BD = b * d;
+        q.C2 = c * c;
+        q.CD = c * d;
+        q.D2 = d * d;
+        return q;
+    }
+
+    Quadric& operator+=(const Quadric& other)
+    {
+        A2 += other.A2;
+        AB += other.AB;
+        AC += other.AC;
+        AD += other.AD;
+        B2 += other.B2;
+        BC += other.BC;
+        BD += other.BD;
+        C2 += other.C2;
+        CD += other.CD;
+        D2 += other.D2;
+        return *this;
+    }
+
+    Quadric operator+(const Quadric& other) const
+    {
+        auto sum = *this;
+        sum += other;
+        return sum;
+    }
+
+    double Evaluate(const FVector3d& p) const
+    {
+        return A2 * p.X * p.X + 2 * AB * p.X * p.Y + 2 * AC * p.X * p.Z + 2 * AD * p.X + B2 * p.Y * p.Y +
+               2 * BC * p.Y * p.Z + 2 * BD * p.Y + C2 * p.Z * p.Z + 2 * CD * p.Z + D2;
+    }
+};
+
+struct CollapseCandidate
+{
+    double Cost;
+    int32 From;
+    int32 To;
+    uint32 FromVersion;
+    uint32 ToVersion;
+
+    bool operator<(const CollapseCandidate& other) const
+    {
+        return Cost < other.Cost;
+    }
+};
+
+struct EdgeInfo
+{
+    int32 TriangleCount;
+    int32 FirstTriangle;
+    bool MaterialSeam;
+};
+
+int32& TriangleIndex(TritonAcousticMeshTriangleInformation& triangle, int corner)
+{
+    return corner == 0 ? triangle.Indices.x : (corner == 1 ? triangle.Indices.y : triangle.Indices.z);
+}
+
+int32 TriangleIndex(const TritonAcousticMeshTriangleInformation& triangle, int corner)
+{
+    return corner == 0 ? triangle.Indices.x : (corner == 1 ? triangle.Indices.y : triangle.Indices.z);
+}
+
+bool ContainsVertex(const TritonAcousticMeshTriangleInformation& triangle, int32 vertex)
+{
+    return triangle.Indices.x == vertex || triangle.Indices.y == vertex || triangle.Indices.z == vertex;
+}
+
+uint64 EdgeKey(int32 a, int32 b)
+{
+    return a < b ? (static_cast<uint64>(a) << 32) | static_cast<uint32>(b)
+                 : (static_cast<uint64>(b) << 32) | static_cast<uint32>(a);
+}
+} // namespace
+
+AcousticsMeshSimplificationStats AcousticsMeshSimplifier::Simplify(
+    TArray<ATKVectorD>& vertices, TArray<TritonAcousticMeshTriangleInformation>& triangles, double maxError)
+{
+    AcousticsMeshSimplificationStats stats;
+    stats.VerticesBefore = vertices.Num();
+    stats.TrianglesBefore = triangles.Num();
+
+    if (maxError > 0 && triangles.Num() > 0)
+    {
+        WeldVertices(vertices, triangles, maxError * c_SimplificationWeldErrorFraction);
+        RemoveDegenerateTriangles(triangles);
+        Decimate(vertices, triangles, maxError);
+        RemoveUnusedVertices(vertices, triangles);
+    }
+
+    stats.VerticesAfter = vertices.Num();
+    stats.TrianglesAfter = triangles.Num();
+    return stats;
+}
+
+void AcousticsMeshSimplifier::WeldVertices(
+    TArray<ATKVectorD>& vertices, TArray<TritonAcousticMeshTriangleInformation>& triangles, double weldDistance)
+{
+    // Uniform grid with cells the size of the weld distance, so only the 27 surrounding cells need checking.
+    // Each cell stores the head of a linked list through cellNext.
+    TMap<FIntVector, int32> cellHeads;
+    cellHeads.Reserve(vertices.Num());
+    TArray<int32> cellNext;
+    cellNext.Init(INDEX_NONE, vertices.Num());
+
+    const auto weldDistanceSquared = weldDistance * weldDistance;
+    auto cellOf = [weldDistance](const ATKVectorD& v) {
+        return FIntVector(
+            FMath::FloorToInt(v.x / weldDistance),
+            FMath::FloorToInt(v.y / weldDistance),
+            FMath::FloorToInt(v.z / weldDistance));
+    };
+
+    TArray<int32> remap;
+    remap.SetNumUninitialized(vertices.Num());
+    for (auto i = 0; i < vertices.Num(); i++)
+    {
+        const auto cell = cellOf(vertices[i]);
+        const auto position = ToVector(vertices[i]);
+
+        auto weldTarget = INDEX_NONE;
+        for (auto x = -1; x <= 1 && weldTarget == INDEX_NONE; x++)
+        {
+            for (auto y = -1; y <= 1 && weldTarget == INDEX_NONE; y++)
+            {
+                for (auto z = -1; z <= 1 && weldTarget == INDEX_NONE; z++)
+                {
+                    const auto head = cellHeads.Find(cell + FIntVector(x, y, z));
+                    for (auto other = head ? *head : INDEX_NONE; other != INDEX_NONE; other = cellNext[other])
+                    {
+                        if (FVector3d::DistSquared(position, ToVector(vertices[other])) <= weldDistanceSquared)
+                        {
+                            weldTarget = other;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (weldTarget != INDEX_NONE)
+        {
+            remap[i] = weldTarget;
+        }
+        else
+        {
+            // Only unwelded vertices go into the grid, so every chain holds representatives
+            auto& head = cellHeads.FindOrAdd(cell, INDEX_NONE);
+            cellNext[i] = head;
+            head = i;
+            remap[i] = i;
+        }
+    }
+
+    for (auto& triangle : triangles)
+    {
+        triangle.Indices = ATKVectorI{remap[triangle.Indices.x], remap[triangle.Indices.y], remap[triangle.Indices.z]};
+    }
+}
+
+void AcousticsMeshSimplifier::RemoveDegenerateTriangles(TArray<TritonAcousticMeshTriangleInformation>& triangles)
+{
+    // Welding collapses slivers to repeated indices, and overlapping copies of the same surface become duplicates.
+    // The key keeps the winding, so the two opposite faces of a double-sided thin wall both stay.
+    TSet<TTuple<FIntVector, TritonMaterialCode>> seenTriangles;
+    seenTriangles.Reserve(triangles.Num());
+
+    triangles.RemoveAll([&seenTriangles](const TritonAcousticMeshTriangleInformation& triangle) {
+        const auto& indices = triangle.Indices;
+        if (indices.x == indices.y || indices.y == indices.z || indices.z == indices.x)
+        {
+            return true;
+        }
+
+        // Rotate the lowest index to the front, which doesn't change the winding
+        FIntVector key(indices.x, indices.y, indices.z);
+        if (key.Y < key.X && key.Y < key.Z)
+        {
+            key = FIntVector(key.Y, key.Z, key.X);
+        }
+        else if (key.Z < key.X && key.Z < key.Y)
+        {
+            key = FIntVector(key.Z, key.X, key.Y);
+        }
+        bool alreadySeen = false;
+        seenTriangles.Add(MakeTuple(key, triangle.MaterialCode), &alreadySeen);
+        return alreadySeen;
+    });
+}
+
+void AcousticsMeshSimplifier::Decimate(
+    TArray<ATKVectorD>& vertices, TArray<TritonAcousticMeshTriangleInformation>& triangles, double maxError)
+{
+    const auto vertexCount = vertices.Num();
+    const auto triangleCount = triangles.Num();
+    const auto maxCost = maxError * maxError;
+
+    TArray<FVector3d> positions;
+    positions.SetNumUninitialized(vertexCount);
+    for (auto i = 0; i < vertexCount; i++)
+    {
+        positions[i] = ToVector(vertices[i]);
+    }
+
+    TArray<Quadric> quadrics;
+    quadrics.SetNum(vertexCount);
+    TArray<FVector3d> triangleNormals;
+    triangleNormals.SetNumUninitialized(triangleCount);
+    TArray<bool> triangleRemoved;
+    triangleRemoved.Init(false, triangleCount);
+    TArray<TArray<int32>> vertexTriangles;
+    vertexTriangles.SetNum(vertexCount);
+
+    auto computeNormal = [](const FVector3d& a, const FVector3d& b, const FVector3d& c, FVector3d& normal) {
+        normal = FVector3d::CrossProduct(b - a, c - a);
+        const auto length = normal.Size();
+        if (length <= UE_DOUBLE_SMALL_NUMBER)
+        {
+            return false;
+        }
+        normal /= length;
+        return true;
+    };
+
+    // Plane quadrics of the original triangles
+    for (auto t = 0; t < triangleCount; t++)
+    {
+        const auto& triangle = triangles[t];
+        const auto& a = positions[triangle.Indices.x];
+        if (!computeNormal(a, positions[triangle.Indices.y], positions[triangle.Indices.z], triangleNormals[t]))
+        {
+            // Zero area triangles don't contribute anything to voxelization
+            triangleRemoved[t] = true;
+            continue;
+        }
+
+        const auto planeQuadric = Quadric::FromPlane(triangleNormals[t], a);
+        for (auto corner = 0; corner < 3; corner++)
+        {
+            const auto vertex = TriangleIndex(triangle, corner);
+            quadrics[vertex] += planeQuadric;
+            vertexTriangles[vertex].Add(t);
+        }
+    }
+
+    // Find boundary edges and seams between materials
+    TMap<uint64, EdgeInfo> edges;
+    edges.Reserve(triangleCount * 3 / 2);
+    for (auto t = 0; t < triangleCount; t++)
+    {
+        if (triangleRemoved[t])
+        {
+            continue;
+        }
+
+        for (auto corner = 0; corner < 3; corner++)
+        {
+            const auto key =
+                EdgeKey(TriangleIndex(triangles[t], corner), TriangleIndex(triangles[t], (corner + 1) % 3));
+            if (auto edge = edges.Find(key))
+            {
+                edge->TriangleCount++;
+                edge->MaterialSeam |= triangles[edge->FirstTriangle].MaterialCode != triangles[t].MaterialCode;
+            }
+            else
+            {
+                edges.Add(key, EdgeInfo{1, t, false});
+            }
+        }
+    }
+
+    // Constrain boundaries and seams with a plane through the edge, perpendicular to the surface.
+    // Sliding along a straight edge costs nothing, moving across it costs the same as leaving the surface.
+    for (const auto& edge : edges)
+    {
+        if (edge.Value.TriangleCount == 2 && !edge.Value.MaterialSeam)
+        {
+            continue;
+        }
+
+        const auto a = static_cast<int32>(edge.Key >> 32);
+        const auto b = static_cast<int32>(edge.Key & 0xffffffff);
+        auto constraintNormal =
+            FVector3d::CrossProduct(positions[b] - positions[a], triangleNormals[edge.Value.FirstTriangle]);
+        if (constraintNormal.Normalize())
+        {
+            const auto constraintQuadric = Quadric::FromPlane(constraintNormal, positions[a]);
+            quadrics[a] += constraintQuadric;
+            quadrics[b] += constraintQuadric;
+        }
+    }
+
+    TArray<uint32> vertexVersions;
+    vertexVersions.Init(0, vertexCount);
+    TArray<bool> vertexRemoved;
+    vertexRemoved.Init(false, vertexCount);
+
+    // Cheapest collapse of an edge, moving whichever endpoint adds less error onto the other one.
+    // Only endpoints are considered, so surviving vertices keep their original (welded) positions.
+    TArray<CollapseCandidate> heap;
+    heap.Reserve(edges.Num());
+    auto pushCandidate = [&](int32 a, int32 b) {
+        const auto combined = quadrics[a] + quadrics[b];
+        const auto costAtA = combined.Evaluate(positions[a]);
+        const auto costAtB = combined.Evaluate(positions[b]);
+        const auto moveAToB = costAtB <= costAtA;
+        const auto cost = moveAToB ? costAtB : costAtA;
+        if (cost <= maxCost)
+        {
+            const auto from = moveAToB ? a : b;
+            const auto to = moveAToB ? b : a;
+            heap.HeapPush(CollapseCandidate{cost, from, to, vertexVersions[from], vertexVersions[to]});
+        }
+    };
+
+    for (const auto& edge : edges)
+    {
+        pushCandidate(static_cast<int32>(edge.Key >> 32), static_cast<int32>(edge.Key & 0xffffffff));
+    }
+    edges.Empty();
+
+    TArray<int32> fromNeighbors;
+    TArray<int32> toNeighbors;
+    auto collectNeighbors = [&](int32 vertex, TArray<int32>& neighbors) {
+        neighbors.Reset();
+        for (auto t : vertexTriangles[vertex])
+        {
+            for (auto corner = 0; corner < 3; corner++)
+            {
+                const auto other = TriangleIndex(triangles[t], corner);
+                if (other != vertex)
+                {
+                    neighbors.AddUnique(other);
+                }
+            }
+        }
+    };
+
+    auto canCollapse = [&](int32 from, int32 to) {
+        // The edge must still exist, and the two vertices may share no neighbors other than the ones opposite
+        // the edge. Otherwise the collapse would fold the surface onto itself.
+        auto sharedTriangles = 0;
+        for (auto t : vertexTriangles[from])
+        {
+            sharedTriangles += ContainsVertex(triangles[t], to) ? 1 : 0;
+        }
+        if (sharedTriangles == 0)
+        {
+            return false;
+        }
+
+        collectNeighbors(from, fromNeighbors);
+        collectNeighbors(to, toNeighbors);
+        auto sharedNeighbors = 0;
+        for (auto neighbor : fromNeighbors)
+        {
+            sharedNeighbors += toNeighbors.Contains(neighbor) ? 1 : 0;
+        }
+        if (sharedNeighbors != sharedTriangles)
+        {
+            return false;
+        }
+
+        // None of the remaining triangles may degenerate or turn over
+        for (auto t : vertexTriangles[from])
+        {
+            const auto& triangle = triangles[t];
+            if (ContainsVertex(triangle, to))
+            {
+                continue;
+            }
+
+            FVector3d corners[3];
+            for (auto corner = 0; corner < 3; corner++)
+            {
+                const auto vertex = TriangleIndex(triangle, corner);
+                corners[corner] = positions[vertex == from ? to : vertex];
+            }
+
+            FVector3d newNormal;
+            if (!computeNormal(corners[0], corners[1], corners[2], newNormal) ||
+                FVector3d::DotProduct(newNormal, triangleNormals[t]) < c_MinNormalDotAfterCollapse)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    CollapseCandidate candidate;
+    while (heap.Num() > 0)
+    {
+        heap.HeapPop(candidate);
+
+        const auto from = candidate.From;
+        const auto to = candidate.To;
+        if (vertexRemoved[from] || vertexRemoved[to] || vertexVersions[from] != candidate.FromVersion ||
+            vertexVersions[to] != candidate.ToVersion || !canCollapse(from, to))
+        {
+            continue;
+        }
+
+        quadrics[to] += quadrics[from];
+
+        for (auto t : vertexTriangles[from])
+        {
+            auto& triangle = triangles[t];
+            if (ContainsVertex(triangle, to))
+            {
+                triangleRemoved[t] = true;
+                continue;
+            }
+
+            for (auto corner = 0; corner < 3; corner++)
+            {
+                auto& vertex = TriangleIndex(triangle, corner);
+                vertex = vertex == from ? to : vertex;
+            }
+            computeNormal(
+                positions[triangle.Indices.x],
+                positions[triangle.Indices.y],
+                positions[triangle.Indices.z],
+                triangleNormals[t]);
+            vertexTriangles[to].Add(t);
+        }
+
+        vertexTriangles[from].Empty();
+        vertexRemoved[from] = true;
+        vertexVersions[from]++;
+        vertexVersions[to]++;
+
+        // Triangles around the removed edge are gone from every vertex they touched
+        collectNeighbors(to, toNeighbors);
+        vertexTriangles[to].RemoveAll([&triangleRemoved](int32 t) { return triangleRemoved[t]; });
+        for (auto neighbor : toNeighbors)
+        {
+            vertexTriangles[neighbor].RemoveAll([&triangleRemoved](int32 t) { return triangleRemoved[t]; });
+        }
+
+        // Everything around the surviving vertex has a new cost
+        collectNeighbors(to, toNeighbors);
+        for (auto neighbor : toNeighbors)
+        {
+            pushCandidate(to, neighbor);
+        }
+    }
+
+    auto next = 0;
+    for (auto t = 0; t < triangleCount; t++)
+    {
+        if (!triangleRemoved[t])
+        {
+            triangles[next++] = triangles[t];
+        }
+    }
+    triangles.SetNum(next);
+}
+
+void AcousticsMeshSimplifier::RemoveUnusedVertices(
+    TArray<ATKVectorD>& vertices, TArray<TritonAcousticMeshTriangleInformation>& triangles)
+{
+    TArray<int32> remap;
+    remap.Init(INDEX_NONE, vertices.Num());
+    TArray<ATKVectorD> usedVertices;
+    usedVertices.Reserve(vertices.Num());
+
+    for (auto& triangle : triangles)
+    {
+        for (auto corner = 0; corner < 3; corner++)
+        {
+            auto& vertex = TriangleIndex(triangle, corner);
+            if (remap[vertex] == INDEX_NONE)
+            {
+                remap[vertex] = usedVertices.Add(vertices[vertex]);
+            }
+            vertex = remap[vertex];
+        }
+    }
+    vertices = MoveTemp(usedVertices);
+}
@@ -0,0 +1,46 @@
+// Copyright (c) 2022 Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+#include "TritonPreprocessorApi.h"
+// Add include for non-unity build
+#include "Containers/Array.h"
+
+// Voxel size in meters is this divided by the simulation frequency. 25cm at 500Hz, scaling linearly.
+const double c_VoxelSizeTimesFrequency = 125.0;
+// How far simplified geometry may move away from the original surfaces, as a fraction of the voxel size
+const double c_SimplificationErrorVoxelFraction = 0.25;
+// Vertices closer together than this fraction of the allowed error are welded
+const double c_SimplificationWeldErrorFraction = 0.1;
+
+struct AcousticsMeshSimplificationStats
+{
+    int VerticesBefore = 0;
+    int VerticesAfter = 0;
+    int TrianglesBefore = 0;
+    int TrianglesAfter = 0;
+};
+
+// Reduces acoustic geometry before it is voxelized. Detail far below a voxel doesn't change the simulation,
+// but still costs memory and voxelization time for every triangle.
+//
+// Vertices are welded across meshes first, so separately authored pieces become one connected surface.
+// Edges are then collapsed cheapest first using quadric error metrics. Coplanar regions have no error at all,
+// so they are merged before anything else, and a collapse is only accepted while the moved vertex stays within
+// maxError of every original plane it touches. Open boundaries and seams between materials are constrained
+// the same way, so outlines and material assignment are kept.
+class AcousticsMeshSimplifier final
+{
+public:
+    // Positions and maxError are in Triton units (meters)
+    static AcousticsMeshSimplificationStats
+    Simplify(TArray<ATKVectorD>& vertices, TArray<TritonAcousticMeshTriangleInformation>& triangles, double maxError);
+
+private:
+    static void WeldVertices(
+        TArray<ATKVectorD>& vertices, TArray<TritonAcousticMeshTriangleInformation>& triangles, double weldDistance);
+    static void RemoveDegenerateTriangles(TArray<TritonAcousticMeshTriangleInformation>& triangles);
+    static void
+    Decimate(TArray<ATKVectorD>& vertices, TArray<TritonAcousticMeshTriangleInformation>& triangles, double maxError);
+    static void
+    RemoveUnusedVertices(TArray<ATKVectorD>& vertices, TArray<TritonAcousticMeshTriangleInformation>& triangles);
+};
@@ -538,6 +538,12 @@ void SAcousticsObjectsTab::OnCheckStateChanged_UsePhysicalMaterials(ECheckBoxSta
 {
     m_AcousticsEditMode->UsePhysicalMaterials = (InState == ECheckBoxState::Checked ? true : false);
 
+    // Every actor may now resolve to different material names
+    if (m_AcousticsEditMode->GetMaterialsTab().IsValid())
+    {
+        m_AcousticsEditMode->GetMaterialsTab()->InvalidateUEMaterials();
+    }
+
     // Write to config file.
     FConfigFile* BaseProjectAcousticsConfigFile;
     FString ConfigFilePath;
@@ -25,6 +25,8 @@
 #include "Widgets/Notifications/SProgressBar.h"
 #include "Materials/Material.h"
 #include "HAL/PlatformFilemanager.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
 #include "Misc/Char.h"
 #include "SlateOptMacros.h"
 #include "Widgets/Input/SButton.h"
@@ -36,6 +38,7 @@
 #include "RawMesh.h"
 #include "LandscapeProxy.h"
 #include "Navmesh/RecastNavMesh.h"
+#include "Detour/DetourNavMesh.h"
 #include "ISourceControlProvider.h"
 #include "ISourceControlModule.h"
 #include "SourceControlHelpers.h"
@@ -56,6 +59,8 @@
 #include "Widgets/Input/SCheckBox.h"
 #include "Widgets/Notifications/SErrorText.h"
 #include "Misc/ScopedSlowTask.h"
+#include "Async/ParallelFor.h"
+#include "NavigationSystem.h"
 
 #include "AcousticsShared.h"
 #include "MaterialDomain.h"
@@ -159,6 +164,13 @@ bool SAcousticsProbesTab::m_CancelRequest = false;
 FString SAcousticsProbesTab::m_CurrentStatus = TEXT("");
 float SAcousticsProbesTab::m_CurrentProgress = 0.0f;
 bool SAcousticsProbesTab::m_ShowSimulationParameters = false;
+// Off until the simplifier has been verified on real scenes, see m_VerifySimplification
+bool SAcousticsProbesTab::m_SimplifyGeometry = false;
+bool SAcousticsProbesTab::m_VerifySimplification = false;
+bool SAcousticsProbesTab::m_CancelSimplificationCheck = false;
+
+// How often to check on a navigation build started by probe calculation, in seconds
+const float c_NavigationBuildPollInterval = 0.25f;
 
 BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
@@ -377,6 +389,46 @@ void SAcousticsProbesTab::Construct(const FArguments& InArgs, SAcousticsEdit* ow
             .AutoWrapText(true)
         .Text_Lambda([this]() { return FText::FromString(m_CurrentStatus); })
         ]
+    + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(FAcousticsEditSharedProperties::StandardPadding)
+        [
+            SNew(SBox)
+            [
+                SNew(SCheckBox)
+        .OnCheckStateChanged(this, &SAcousticsProbesTab::OnCheckStateChanged_SimplifyGeometry)
+        .IsChecked(this, &SAcousticsProbesTab::GetCheckState_SimplifyGeometry)
+        .IsEnabled(this, &SAcousticsProbesTab::ShouldEnableForProcessing)
+        .ToolTipText(LOCTEXT("SimplifyGeometryTooltip", "Experimental. Weld and decimate acoustic geometry before "
+                                                        "probe calculation. Only detail well below the voxel size is "
+                                                        "removed, but voxels at surface boundaries can still change."))
+        [
+            SNew(STextBlock)
+            .Text(LOCTEXT("SimplifyGeometry", "Simplify Acoustic Geometry"))
+        .Font(StandardFont)
+        ]
+            ]
+        ]
+    + SVerticalBox::Slot()
+        .AutoHeight()
+        .Padding(FAcousticsEditSharedProperties::StandardPadding)
+        [
+            SNew(SBox)
+            [
+                SNew(SCheckBox)
+        .OnCheckStateChanged(this, &SAcousticsProbesTab::OnCheckStateChanged_VerifySimplification)
+        .IsChecked(this, &SAcousticsProbesTab::GetCheckState_VerifySimplification)
+        .IsEnabled_Lambda([this]() { return m_SimplifyGeometry && ShouldEnableForProcessing(); })
+        .ToolTipText(LOCTEXT("VerifySimplificationTooltip", "Calculate with the original geometry, and also "
+                                                            "voxelize the simplified geometry to report any voxels "
+                                                            "that differ."))
+        [
+            SNew(STextBlock)
+            .Text(LOCTEXT("VerifySimplification", "Verify Simplification"))
+        .Font(StandardFont)
+        ]
+            ]
+        ]
     + SVerticalBox::Slot()
         .AutoHeight()
         .Padding(FAcousticsEditSharedProperties::StandardPadding)
@@ -426,6 +478,21 @@ void SAcousticsProbesTab::Construct(const FArguments& InArgs, SAcousticsEdit* ow
 
 END_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
+SAcousticsProbesTab::~SAcousticsProbesTab()
+{
+    if (m_NavigationBuildTicker.IsValid())
+    {
+#if ENGINE_MAJOR_VERSION == 5
+        FTSTicker::GetCoreTicker().RemoveTicker(m_NavigationBuildTicker);
+#else
+        FTicker::GetCoreTicker().RemoveTicker(m_NavigationBuildTicker);
+#endif
+        m_CurrentStatus = TEXT("");
+        m_CurrentProgress = 0;
+    }
+    StopSimplificationCheck();
+}
+
 void SAcousticsProbesTab::OnCheckStateChanged_ShowSimulationParameters(ECheckBoxState InState)
 {
     m_ShowSimulationParameters = (InState == ECheckBoxState::Checked ? true : false);
@@ -436,6 +503,26 @@ ECheckBoxState SAcousticsProbesTab::GetCheckState_ShowSimulationParameters() con
     return m_ShowSimulationParameters ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 }
 
+void SAcousticsProbesTab::OnCheckStateChanged_SimplifyGeometry(ECheckBoxState InState)
+{
+    m_SimplifyGeometry = (InState == ECheckBoxState::Checked ? true : false);
+}
+
+ECheckBoxState SAcousticsProbesTab::GetCheckState_SimplifyGeometry() const
+{
+    return m_SimplifyGeometry ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SAcousticsProbesTab::OnCheckStateChanged_VerifySimplification(ECheckBoxState InState)
+{
+    m_VerifySimplification = (InState == ECheckBoxState::Checked ? true : false);
+}
+
+ECheckBoxState SAcousticsProbesTab::GetCheckState_VerifySimplification() const
+{
+    return m_VerifySimplification ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
 FReply SAcousticsProbesTab::OnResetSimulationParametersButton()
 {
     auto defaultSimParams = AcousticsSharedState::GetDefaultSimulationParameters();
@@ -662,104 +749,6 @@ FReply SAcousticsProbesTab::OnAcousticsDataFolderButtonClick()
     return FReply::Handled();
 }
 
-// Closely based on: UnFbx::FFbxImporter::BuildStaticMeshFromGeometry()
-UStaticMesh* ConstructStaticMeshGeo(const TArray<FVector>& verts, const TArray<int32>& indices, FName meshName)
-{
-    int32 triangleCount = indices.Num() / 3;
-    int32 wedgeCount = triangleCount * 3;
-
-    FRawMesh rawMesh;
-    rawMesh.FaceMaterialIndices.AddZeroed(triangleCount);
-    rawMesh.FaceSmoothingMasks.AddZeroed(triangleCount);
-    rawMesh.WedgeIndices.AddZeroed(wedgeCount);
-    rawMesh.WedgeTexCoords[0].AddZeroed(wedgeCount);
-
-    TMap<int32, int32> indexMap;
-    for (int32 triangleIndex = 0; triangleIndex < triangleCount; triangleIndex++)
-    {
-        for (int32 cornerIndex = 0; cornerIndex < 3; cornerIndex++)
-        {
-            int32 wedgeIndex = triangleIndex * 3 + cornerIndex;
-
-            // Store vertex index and position.
-            int32 controlPointIndex = indices[wedgeIndex]; // Mesh->GetPolygonVertex(TriangleIndex, CornerIndex);
-            int32* existingIndex = indexMap.Find(controlPointIndex);
-            if (existingIndex)
-            {
-                rawMesh.WedgeIndices[wedgeIndex] = *existingIndex;
-            }
-            else
-            {
-                int32 vertexIndex = rawMesh.VertexPositions.Add(static_cast<FVector3f>(verts[controlPointIndex]));
-                rawMesh.WedgeIndices[wedgeIndex] = vertexIndex;
-                indexMap.Add(controlPointIndex, vertexIndex);
-            }
-
-            // normals, tangents and binormals : SKIP
-            // vertex colors : SKIP
-
-            // uvs: we don't care about these, but these are required for a legal mesh
-            rawMesh.WedgeTexCoords[0][wedgeIndex].X = 0.0f;
-            rawMesh.WedgeTexCoords[0][wedgeIndex].Y = 0.0f;
-        }
-        // smoothing mask : SKIP
-        // uvs: taken care of above.
-
-        // material index
-        rawMesh.FaceMaterialIndices[triangleIndex] = 0;
-    }
-
-    TArray<FStaticMaterial> mats;
-    mats.Add(FStaticMaterial(CastChecked<UMaterialInterface>(UMaterial::GetDefaultMaterial(MD_Surface))));
-
-    return CreateStaticMesh(rawMesh, mats, GetTransientPackage(), meshName);
-}
-
-static const FName c_NavMeshName(TEXT("TritonNavigableArea"));
-
-UStaticMesh* ExtractStaticMeshFromNavigationMesh(const ARecastNavMesh* navMeshActor, UWorld* world)
-{
-    check(navMeshActor != nullptr);
-
-    // Extract out navmesh triangulated geo
-    // Code motivated from UNavMeshRenderingComponent::GatherData() >>> if (NavMesh->bDrawTriangleEdges)...
-    TArray<FVector> navVerts;
-    TArray<int32> navIndices;
-
-    FRecastDebugGeometry geom;
-#if ENGINE_MAJOR_VERSION == 4 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION < 1)
-    navMeshActor->GetDebugGeometry(geom);
-#else
-    navMeshActor->GetDebugGeometryForTile(geom, INDEX_NONE);
-#endif
-
-    // Collect all the vertices
-    for (auto& vert : geom.MeshVerts)
-    {
-        navVerts.Add(vert);
-    }
-
-    // Collect all the indices
-    for (int32 areaIdx = 0; areaIdx < RECAST_MAX_AREAS; ++areaIdx)
-    {
-        for (int32 idx : geom.AreaIndices[areaIdx])
-        {
-            navIndices.Add(idx);
-        }
-    }
-
-    // Create static mesh from nav mesh data
-    UStaticMesh* staticMesh = ConstructStaticMeshGeo(navVerts, navIndices, c_NavMeshName);
-
-    if (!staticMesh)
-    {
-        UE_LOG(LogAcoustics, Error, TEXT("Failed while creating static mesh from nav mesh data"));
-        return nullptr;
-    }
-
-    return staticMesh;
-}
-
 // Use this function for probe volume processing code used when adding both static meshes as well as landscapes to the
 // acoustic mesh
 void SAcousticsProbesTab::ApplyOverridesAndRemapsFromProbeVolumesOnTriangle(
@@ -1610,64 +1599,174 @@ void SAcousticsProbesTab::AddPinnedProbeToAcousticMesh(AcousticMesh* acousticMes
     acousticMesh->AddPinnedProbe(ATKVectorD(probeLocation.X, probeLocation.Y, probeLocation.Z));
 }
 
-void SAcousticsProbesTab::AddNavmeshToAcousticMesh(
-    AcousticMesh* acousticMesh, ARecastNavMesh* navActor, TArray<UMaterialInterface*> materials,
-    TArray<uint32>& materialIDsNotFound)
+// Reads the detail triangles of every tile straight from the nav mesh, instead of going through a transient static
+// mesh with render data. Tiles are independent, so they are gathered and converted in parallel.
+void SAcousticsProbesTab::AddNavmeshToAcousticMesh(AcousticMesh* acousticMesh, ARecastNavMesh* navActor)
 {
-    auto staticMesh = ExtractStaticMeshFromNavigationMesh(navActor, GEditor->GetWorld());
-    if (!staticMesh)
+    struct NavmeshTile
     {
-        return;
-    }
+        TArray<ATKVectorD> Vertices;
+        TArray<ATKVectorI> Triangles;
+    };
 
-    const auto checkHasVerts = true;
-    const auto LOD = 0;
-    if (staticMesh->HasValidRenderData(checkHasVerts, LOD))
-    {
-        AddStaticMeshToAcousticMesh(
-            acousticMesh,
-            navActor,
-            FTransform::Identity,
-            staticMesh,
-            materials,
-            MeshTypeNavigation,
-            materialIDsNotFound);
-        return;
+    // Debug geometry is looked up by Detour tile slot. Slots can be empty, so collect the occupied ones first.
+    TArray<int32> tileIndices;
+    const dtNavMesh* detourMesh = navActor->GetRecastMesh();
+    if (detourMesh != nullptr)
+    {
+        for (auto i = 0; i < detourMesh->getMaxTiles(); i++)
+        {
+            const auto detourTile = detourMesh->getTile(i);
+            if (detourTile != nullptr && detourTile->header != nullptr)
+            {
+                tileIndices.Add(i);
+            }
+        }
     }
 
-    UE_LOG(
-        LogAcoustics,
-        Warning,
-        TEXT("Nav mesh [%s] has no valid render data for LOD %d. Triggering navigation build..."),
-        *navActor->GetName(),
-        LOD);
+    const auto tileCount = tileIndices.Num();
+    TArray<NavmeshTile> tiles;
+    tiles.SetNum(tileCount);
 
-    // trigger navigation rebuild and block on it so we can export it
-    navActor->RebuildAll();
-    navActor->EnsureBuildCompletion();
+    // Only reads the built nav mesh. ComputePrebake waits for any running navigation build, including dirty area
+    // rebuilds, before it gets here, and everything below runs within this call on the game thread, which is where
+    // the navigation system applies finished tiles.
+    ParallelFor(tileCount, [navActor, &tileIndices, &tiles](int32 i) {
+        // Code motivated from UNavMeshRenderingComponent::GatherData() >>> if (NavMesh->bDrawTriangleEdges)...
+        FRecastDebugGeometry geom;
+#if ENGINE_MAJOR_VERSION == 4 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION < 1)
+        navActor->GetDebugGeometry(geom, tileIndices[i]);
+#else
+        navActor->GetDebugGeometryForTile(geom, tileIndices[i]);
+#endif
 
-    auto staticMeshRebuilt = ExtractStaticMeshFromNavigationMesh(navActor, GEditor->GetWorld());
-    if (staticMeshRebuilt != nullptr && staticMeshRebuilt->HasValidRenderData(checkHasVerts, LOD))
+        auto& tile = tiles[i];
+        tile.Vertices.Reserve(geom.MeshVerts.Num());
+        for (const auto& vert : geom.MeshVerts)
+        {
+            auto vertex = AcousticsUtils::UnrealPositionToTriton(FVector(vert));
+            tile.Vertices.Add(ATKVectorD{vertex.X, vertex.Y, vertex.Z});
+        }
+
+        for (int32 areaIdx = 0; areaIdx < RECAST_MAX_AREAS; ++areaIdx)
+        {
+            const auto& areaIndices = geom.AreaIndices[areaIdx];
+            for (auto i = 0; i + 2 < areaIndices.Num(); i += 3)
+            {
+                tile.Triangles.Add(ATKVectorI{areaIndices[i], areaIndices[i + 1], areaIndices[i + 2]});
+            }
+        }
+    });
+
+    // Every tile indexes its own vertices, offset them into one shared buffer
+    TArray<int32> vertexOffsets;
+    TArray<int32> triangleOffsets;
+    vertexOffsets.SetNumUninitialized(tileCount);
+    triangleOffsets.SetNumUninitialized(tileCount);
+    auto vertexCount = 0;
+    auto triangleCount = 0;
+    for (auto i = 0; i < tileCount; i++)
     {
-        UE_LOG(LogAcoustics, Log, TEXT("Nav mesh [%s] successfully rebuilt."), *navActor->GetName());
-        AddStaticMeshToAcousticMesh(
-            acousticMesh,
-            navActor,
-            navActor->GetTransform(),
-            staticMeshRebuilt,
-            materials,
-            MeshTypeNavigation,
-            materialIDsNotFound);
+        vertexOffsets[i] = vertexCount;
+        triangleOffsets[i] = triangleCount;
+        vertexCount += tiles[i].Vertices.Num();
+        triangleCount += tiles[i].Triangles.Num();
     }
-    else
+
+    if (triangleCount == 0)
+    {
+        UE_LOG(
+            LogAcoustics,
+            Warning,
+            TEXT("Nav mesh [%s] has no navigable triangles, investigate in editor. Ignoring and continuing."),
+            *navActor->GetName());
+        return;
+    }
+
+    TArray<ATKVectorD> vertices;
+    TArray<TritonAcousticMeshTriangleInformation> triangleInfos;
+    vertices.SetNumUninitialized(vertexCount);
+    triangleInfos.SetNumUninitialized(triangleCount);
+    ParallelFor(tileCount, [&](int32 tileIndex) {
+        const auto& tile = tiles[tileIndex];
+        const auto vertexOffset = vertexOffsets[tileIndex];
+        FMemory::Memcpy(&vertices[vertexOffset], tile.Vertices.GetData(), tile.Vertices.Num() * sizeof(ATKVectorD));
+
+        auto triangleInfo = &triangleInfos[triangleOffsets[tileIndex]];
+        for (const auto& triangle : tile.Triangles)
+        {
+            triangleInfo->Indices =
+                ATKVectorI{triangle.x + vertexOffset, triangle.y + vertexOffset, triangle.z + vertexOffset};
+            // Metadata meshes like nav meshes will ignore material, provide default.
+            triangleInfo->MaterialCode = TRITON_DEFAULT_WALL_CODE;
+            triangleInfo++;
+        }
+    });
+
+    acousticMesh->Add(
+        vertices.GetData(), vertices.Num(), triangleInfos.GetData(), triangleInfos.Num(), MeshTypeNavigation);
+}
+
+// Kicks off a build of nav meshes that have no data yet. The editor keeps running while it builds, and probe
+// calculation is started again from OnNavigationBuildTick once the build is done.
+void SAcousticsProbesTab::StartNavigationBuild(const TArray<ARecastNavMesh*>& navActors)
+{
+    for (auto navActor : navActors)
     {
         UE_LOG(
             LogAcoustics,
             Warning,
-            TEXT("Automatic rebuild of nav mesh [%s] failed, investigate in editor. Ignoring and "
-                 "continuing."),
+            TEXT("Nav mesh [%s] has no navigation data. Triggering navigation build..."),
             *navActor->GetName());
+        navActor->RebuildAll();
     }
+
+    WaitForNavigationBuild();
+}
+
+// Polls the running navigation build from OnNavigationBuildTick, which restarts probe calculation once it's done
+void SAcousticsProbesTab::WaitForNavigationBuild()
+{
+    m_NavigationBuildTaskCount = 0;
+    m_CurrentProgress = 0.01f;
+    m_CurrentStatus = TEXT("Building navigation. Probe calculation will continue once it finishes.");
+#if ENGINE_MAJOR_VERSION == 5
+    m_NavigationBuildTicker = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateSP(this, &SAcousticsProbesTab::OnNavigationBuildTick), c_NavigationBuildPollInterval);
+#else
+    m_NavigationBuildTicker = FTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateSP(this, &SAcousticsProbesTab::OnNavigationBuildTick), c_NavigationBuildPollInterval);
+#endif
+}
+
+bool SAcousticsProbesTab::OnNavigationBuildTick(float deltaTime)
+{
+    auto navSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GEditor->GetEditorWorldContext().World());
+    if (navSys != nullptr && navSys->IsNavigationBuildInProgress())
+    {
+        // Report progress against the most outstanding tasks seen so far
+        const auto remainingTasks = navSys->GetNumRemainingBuildTasks() + navSys->GetNumRunningBuildTasks();
+        m_NavigationBuildTaskCount = FMath::Max(m_NavigationBuildTaskCount, remainingTasks);
+        const auto completed = m_NavigationBuildTaskCount > 0
+                                   ? 1.0f - static_cast<float>(remainingTasks) / m_NavigationBuildTaskCount
+                                   : 0.0f;
+        m_CurrentProgress = FMath::Clamp(completed, 0.01f, 0.99f);
+        m_CurrentStatus = FString::Printf(
+            TEXT("Building navigation, %d tasks remaining. Probe calculation will continue once it finishes."),
+            remainingTasks);
+        return true;
+    }
+
+    UE_LOG(LogAcoustics, Log, TEXT("Navigation build finished. Continuing probe calculation."));
+    m_NavigationBuildTicker.Reset();
+    m_CurrentStatus = TEXT("");
+    m_CurrentProgress = 0;
+
+    // Don't trigger another build if the nav mesh is still empty, AddNavmeshToAcousticMesh reports it instead
+    m_NavigationBuildAttempted = true;
+    ComputePrebake();
+    m_NavigationBuildAttempted = false;
+    return false;
 }
 
 void SAcousticsProbesTab::ComputePrebake()
@@ -1685,6 +1784,7 @@ void SAcousticsProbesTab::ComputePrebake()
     auto taggedActors = 0;
     auto taggedGeo = 0;
     auto taggedNav = 0;
+    TArray<ARecastNavMesh*> unbuiltNavMeshes;
     for (TActorIterator<AActor> itr(GEditor->GetEditorWorldContext().World()); itr; ++itr)
     {
         auto actor = *itr;
@@ -1707,6 +1807,13 @@ void SAcousticsProbesTab::ComputePrebake()
         taggedActors += (isGeo || isNav) ? 1 : 0;
         taggedGeo += isGeo ? 1 : 0;
         taggedNav += isNav ? 1 : 0;
+
+        // Nav meshes without any tiles haven't been built yet
+        auto navActor = Cast<ARecastNavMesh>(actor);
+        if (isNav && navActor != nullptr && navActor->GetNavMeshTilesCount() == 0)
+        {
+            unbuiltNavMeshes.Add(navActor);
+        }
     }
 
     // Do a precheck for tagged geo and nav before we start processing meshes, which could take a while
@@ -1722,10 +1829,30 @@ void SAcousticsProbesTab::ComputePrebake()
         return;
     }
 
+    // Build missing nav meshes first instead of blocking the editor until they're done.
+    // If a build didn't produce anything, carry on and report it when the nav mesh is added.
+    if (unbuiltNavMeshes.Num() > 0 && !m_NavigationBuildAttempted)
+    {
+        StartNavigationBuild(unbuiltNavMeshes);
+        return;
+    }
+
+    // The nav meshes have data, but the editor may still be rebuilding dirty areas, e.g. after an actor was moved.
+    // Reading tiles mid-rebuild could pick up a half-updated nav mesh, so wait for it the same way.
+    auto navSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GEditor->GetEditorWorldContext().World());
+    if (navSys != nullptr && navSys->IsNavigationBuildInProgress())
+    {
+        UE_LOG(
+            LogAcoustics,
+            Log,
+            TEXT("Navigation build in progress. Probe calculation will continue once it finishes."));
+        WaitForNavigationBuild();
+        return;
+    }
+
     // Used to track any materials that aren't properly mapped
     // Will display error text to help with debugging
     TArray<uint32> materialIDsNotFound;
-    TArray<UMaterialInterface*> emptyMaterials;
 
     // Create the acoustic mesh
     TSharedPtr<AcousticMesh> acousticMesh = MakeShareable<AcousticMesh>(AcousticMesh::Create().Release());
@@ -1733,6 +1860,28 @@ void SAcousticsProbesTab::ComputePrebake()
     bool cancelledAcousticMesh = false;
     bool ignoreLargeMeshes = false;
 
+    // Geometry detail well below a voxel doesn't survive voxelization, so let the acoustic mesh drop it.
+    // When verifying, the scene is calculated unsimplified and a simplified copy is only voxelized for comparison.
+    StopSimplificationCheck();
+    TSharedPtr<AcousticMesh> simplifiedMesh;
+    const auto simulationParameters = AcousticsSharedState::GetTritonSimulationParameters();
+    if (m_SimplifyGeometry && simulationParameters.SimulationFrequency > 0 &&
+        simulationParameters.MeshUnitAdjustment > 0)
+    {
+        const auto voxelSize = c_VoxelSizeTimesFrequency / simulationParameters.SimulationFrequency;
+        const auto maxError = c_SimplificationErrorVoxelFraction * voxelSize / simulationParameters.MeshUnitAdjustment;
+        if (m_VerifySimplification)
+        {
+            simplifiedMesh = MakeShareable<AcousticMesh>(AcousticMesh::Create().Release());
+            simplifiedMesh->SetGeometrySimplificationError(maxError);
+            acousticMesh->SetMirrorMesh(simplifiedMesh);
+        }
+        else
+        {
+            acousticMesh->SetGeometrySimplificationError(maxError);
+        }
+    }
+
     // Use a scoped task so that UI isn't blocked, user is informed on the progress, and can cancel early
     FScopedSlowTask acousticMeshDialog(
         taggedActors, LOCTEXT("AcousticMeshCreationDialog", "Getting things ready. Adding tagged objects to the Acoustic Mesh..."));
@@ -1783,8 +1932,7 @@ void SAcousticsProbesTab::ComputePrebake()
             // Nav Meshes
             if (actor->IsA<ARecastNavMesh>())
             {
-                AddNavmeshToAcousticMesh(
-                    acousticMesh.Get(), Cast<ARecastNavMesh>(actor), emptyMaterials, materialIDsNotFound);
+                AddNavmeshToAcousticMesh(acousticMesh.Get(), Cast<ARecastNavMesh>(actor));
                 // If it's a nav mesh, no need to check if it contains static meshes or landscapes
                 // further down. Simply add it to the acoustic mesh and move on to the next actor.
                 continue;
@@ -1990,6 +2138,25 @@ void SAcousticsProbesTab::ComputePrebake()
     }
 #endif // ENABLE_COLLISION_SUPPORT
 
+    AcousticsMeshSimplificationStats simplificationStats;
+    if (!acousticMesh->FinalizeGeometry(&simplificationStats))
+    {
+        UE_LOG(LogAcoustics, Error, TEXT("Failed to add simplified geometry to the acoustic mesh."));
+        m_OwnerEdit->SetError(TEXT("Failed to add simplified geometry to the acoustic mesh."));
+        return;
+    }
+    if (simplificationStats.TrianglesBefore > 0)
+    {
+        UE_LOG(
+            LogAcoustics,
+            Display,
+            TEXT("Simplified acoustic geometry from %d to %d triangles and %d to %d vertices."),
+            simplificationStats.TrianglesBefore,
+            simplificationStats.TrianglesAfter,
+            simplificationStats.VerticesBefore,
+            simplificationStats.VerticesAfter);
+    }
+
     auto config = AcousticsSimulationConfiguration::Create(
         acousticMesh,
         AcousticsSharedState::GetTritonSimulationParameters(),
@@ -2000,6 +2167,10 @@ void SAcousticsProbesTab::ComputePrebake()
     {
         AcousticsSharedState::SetSimulationConfiguration(MoveTemp(config));
         m_OwnerEdit->SetError(TEXT(""));
+        if (simplifiedMesh.IsValid())
+        {
+            StartSimplificationCheck(simplifiedMesh);
+        }
     }
     else
     {
@@ -2008,9 +2179,219 @@ void SAcousticsProbesTab::ComputePrebake()
     }
 }
 
+void SAcousticsProbesTab::StartSimplificationCheck(TSharedPtr<AcousticMesh> simplifiedMesh)
+{
+    // Processed into a scratch folder, so the regular vox and config files aren't touched
+    const auto workingDir = GetSimplificationCheckDir();
+    IFileManager::Get().DeleteDirectory(*workingDir, false, true);
+    IFileManager::Get().MakeDirectory(*workingDir, true);
+
+    auto opParams = AcousticsSharedState::GetTritonOperationalParameters();
+    memset(opParams.WorkingDir, 0, sizeof(opParams.WorkingDir));
+    strncpy_s(opParams.WorkingDir, TRITON_MAX_PATH_LENGTH, TCHAR_TO_ANSI(*workingDir), workingDir.Len());
+
+    m_CancelSimplificationCheck = false;
+    auto checkConfig = AcousticsSimulationConfiguration::Create(
+        simplifiedMesh,
+        AcousticsSharedState::GetTritonSimulationParameters(),
+        opParams,
+        AcousticsSharedState::GetMaterialsLibrary(),
+        &SAcousticsProbesTab::SimplificationCheckCallback);
+    if (!checkConfig)
+    {
+        UE_LOG(LogAcoustics, Warning, TEXT("Failed to start voxelizing the simplified geometry for verification."));
+        return;
+    }
+
+    m_SimplificationCheckConfig = MakeShareable<AcousticsSimulationConfiguration>(checkConfig.Release());
+    m_SimplificationCheckedConfig = AcousticsSharedState::GetSharedSimulationConfiguration();
+#if ENGINE_MAJOR_VERSION == 5
+    m_SimplificationCheckTicker = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateSP(this, &SAcousticsProbesTab::OnSimplificationCheckTick),
+        c_NavigationBuildPollInterval);
+#else
+    m_SimplificationCheckTicker = FTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateSP(this, &SAcousticsProbesTab::OnSimplificationCheckTick),
+        c_NavigationBuildPollInterval);
+#endif
+}
+
+bool SAcousticsProbesTab::OnSimplificationCheckTick(float deltaTime)
+{
+    // Comparing, the result is logged by the comparison itself
+    if (m_SimplificationCompareFuture.IsValid())
+    {
+        if (!m_SimplificationCompareFuture.IsReady())
+        {
+            return true;
+        }
+        m_SimplificationCheckTicker.Reset();
+        ClearSimplificationCheck();
+        return false;
+    }
+
+    // Cleared or recalculated in the meantime, nothing left to compare against
+    if (AcousticsSharedState::GetSimulationConfiguration() != m_SimplificationCheckedConfig.Get())
+    {
+        m_SimplificationCheckTicker.Reset();
+        ClearSimplificationCheck();
+        return false;
+    }
+
+    const auto state = m_SimplificationCheckedConfig->GetState();
+    const auto checkState = m_SimplificationCheckConfig->GetState();
+    if (state == SimulationConfigurationState::InProcess || checkState == SimulationConfigurationState::InProcess)
+    {
+        return true;
+    }
+
+    if (state == SimulationConfigurationState::Ready && checkState == SimulationConfigurationState::Ready)
+    {
+        // Reads every voxel of both grids, which takes far too long for the editor thread on a real level. Both
+        // configurations are held by this tab until the comparison is done.
+        const auto config = m_SimplificationCheckedConfig.Get();
+        const auto checkConfig = m_SimplificationCheckConfig.Get();
+        m_SimplificationCompareFuture = Async(EAsyncExecution::ThreadPool, [config, checkConfig]() {
+            CompareSimplificationCheckVoxels(*config, *checkConfig);
+        });
+        return true;
+    }
+
+    if (state == SimulationConfigurationState::Ready)
+    {
+        UE_LOG(LogAcoustics, Warning, TEXT("Failed to voxelize the simplified geometry for verification."));
+    }
+
+    m_SimplificationCheckTicker.Reset();
+    ClearSimplificationCheck();
+    return false;
+}
+
+void SAcousticsProbesTab::CompareSimplificationCheckVoxels(
+    const AcousticsSimulationConfiguration& config, const AcousticsSimulationConfiguration& checkConfig)
+{
+    FBox box, boxTriton, checkBox, checkBoxTriton;
+    FIntVector counts, checkCounts;
+    float cellSize, checkCellSize;
+    if (!config.GetVoxelMapInfo(box, boxTriton, counts, cellSize) ||
+        !checkConfig.GetVoxelMapInfo(checkBox, checkBoxTriton, checkCounts, checkCellSize))
+    {
+        UE_LOG(LogAcoustics, Warning, TEXT("Failed to read the voxel maps for simplification verification."));
+        return;
+    }
+
+    if (counts != checkCounts || !boxTriton.Min.Equals(checkBoxTriton.Min) || cellSize != checkCellSize)
+    {
+        UE_LOG(
+            LogAcoustics,
+            Warning,
+            TEXT("Simplified geometry changed the voxel grid from %dx%dx%d to %dx%dx%d. The calculated configuration "
+                 "uses the original geometry."),
+            counts.X,
+            counts.Y,
+            counts.Z,
+            checkCounts.X,
+            checkCounts.Y,
+            checkCounts.Z);
+        return;
+    }
+
+    // One slice per task, each checks for cancellation so stopping the check doesn't wait for the whole grid
+    TArray<int64> changedPerSlice;
+    changedPerSlice.SetNumZeroed(counts.X);
+    ParallelFor(counts.X, [&](int32 x) {
+        if (m_CancelSimplificationCheck)
+        {
+            return;
+        }
+        for (auto y = 0; y < counts.Y; ++y)
+        {
+            for (auto z = 0; z < counts.Z; ++z)
+            {
+                if (config.IsVoxelOccupied(x, y, z) != checkConfig.IsVoxelOccupied(x, y, z))
+                {
+                    changedPerSlice[x]++;
+                }
+            }
+        }
+    });
+    if (m_CancelSimplificationCheck)
+    {
+        return;
+    }
+
+    int64 changedVoxels = 0;
+    for (const auto changed : changedPerSlice)
+    {
+        changedVoxels += changed;
+    }
+
+    const auto totalVoxels = static_cast<int64>(counts.X) * counts.Y * counts.Z;
+    if (changedVoxels > 0)
+    {
+        UE_LOG(
+            LogAcoustics,
+            Warning,
+            TEXT("Simplified geometry changed %lld of %lld voxels. The calculated configuration uses the original "
+                 "geometry."),
+            changedVoxels,
+            totalVoxels);
+    }
+    else
+    {
+        UE_LOG(
+            LogAcoustics, Display, TEXT("Simplified geometry voxelizes identically (%lld voxels)."), totalVoxels);
+    }
+}
+
+void SAcousticsProbesTab::StopSimplificationCheck()
+{
+    if (m_SimplificationCheckTicker.IsValid())
+    {
+#if ENGINE_MAJOR_VERSION == 5
+        FTSTicker::GetCoreTicker().RemoveTicker(m_SimplificationCheckTicker);
+#else
+        FTicker::GetCoreTicker().RemoveTicker(m_SimplificationCheckTicker);
+#endif
+        m_SimplificationCheckTicker.Reset();
+    }
+    ClearSimplificationCheck();
+}
+
+void SAcousticsProbesTab::ClearSimplificationCheck()
+{
+    if (m_SimplificationCheckConfig)
+    {
+        // Both the comparison and destroying the configuration wait for work in flight, make that stop early
+        m_CancelSimplificationCheck = true;
+        if (m_SimplificationCompareFuture.IsValid())
+        {
+            m_SimplificationCompareFuture.Wait();
+            m_SimplificationCompareFuture = TFuture<void>();
+        }
+        m_SimplificationCheckConfig.Reset();
+        m_CancelSimplificationCheck = false;
+        IFileManager::Get().DeleteDirectory(*GetSimplificationCheckDir(), false, true);
+    }
+    m_SimplificationCheckedConfig.Reset();
+}
+
+FString SAcousticsProbesTab::GetSimplificationCheckDir()
+{
+    return FPaths::ConvertRelativePathToFull(
+        FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("Acoustics"), TEXT("SimplificationCheck")));
+}
+
+bool SAcousticsProbesTab::SimplificationCheckCallback(const char* message, int progress)
+{
+    // Progress and status belong to the regular calculation, only log here
+    UE_LOG(LogAcoustics, Verbose, TEXT("Simplification check: %s"), ANSI_TO_TCHAR(message));
+    return m_CancelSimplificationCheck || m_CancelRequest;
+}
+
 bool SAcousticsProbesTab::ShouldEnableForProcessing() const
 {
-    return !AcousticsSharedState::IsPrebakeActive();
+    return !AcousticsSharedState::IsPrebakeActive() && !m_NavigationBuildTicker.IsValid();
 }
 
 bool SAcousticsProbesTab::ComputePrebakeCallback(const char* message, int progress)
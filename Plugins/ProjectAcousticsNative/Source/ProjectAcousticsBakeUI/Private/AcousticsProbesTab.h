@@ -5,7 +5,10 @@
 #include "Widgets/SCompoundWidget.h"
 #include "Runtime/Core/Public/Containers/Array.h"
 #include "AcousticsMesh.h"
+#include "AcousticsSimulationConfiguration.h"
 #include "AcousticsSimulationParametersPanel.h"
+#include "Containers/Ticker.h"
+#include "Runtime/Launch/Resources/Version.h"
 #include "AcousticsProbesTab.generated.h"
 
 UENUM()
@@ -53,6 +56,7 @@ public:
     SLATE_END_ARGS()
 
     void Construct(const FArguments& InArgs, SAcousticsEdit* ownerEdit);
+    ~SAcousticsProbesTab();
 
 private:
     FText GetCalculateClearText() const;
@@ -67,6 +71,10 @@ private:
     EVisibility GetSimulationParameterVisibility() const;
     void OnCheckStateChanged_ShowSimulationParameters(ECheckBoxState InState);
     ECheckBoxState GetCheckState_ShowSimulationParameters() const;
+    void OnCheckStateChanged_SimplifyGeometry(ECheckBoxState InState);
+    ECheckBoxState GetCheckState_SimplifyGeometry() const;
+    void OnCheckStateChanged_VerifySimplification(ECheckBoxState InState);
+    ECheckBoxState GetCheckState_VerifySimplification() const;
 
     FText GetCurrentResolutionLabel() const;
     TSharedRef<SWidget> MakeResolutionOptionsWidget(TSharedPtr<FString> inString);
@@ -96,9 +104,21 @@ private:
         AcousticMesh* acousticMesh, class AAcousticsProbeVolume* Actor, TArray<uint32>& materialIDsNotFound);
     void AddPinnedProbeToAcousticMesh(AcousticMesh* acousticMesh, const FVector& probeLocation);
 
-    void AddNavmeshToAcousticMesh(
-        AcousticMesh* acousticMesh, class ARecastNavMesh* navActor, TArray<UMaterialInterface*> materials,
-        TArray<uint32>& materialIDsNotFound);
+    void AddNavmeshToAcousticMesh(AcousticMesh* acousticMesh, class ARecastNavMesh* navActor);
+    void StartNavigationBuild(const TArray<class ARecastNavMesh*>& navActors);
+    void WaitForNavigationBuild();
+    bool OnNavigationBuildTick(float deltaTime);
+
+    // Voxelizes the simplified copy of the scene next to the regular calculation and compares the voxels on a
+    // worker thread once both are done
+    void StartSimplificationCheck(TSharedPtr<AcousticMesh> simplifiedMesh);
+    bool OnSimplificationCheckTick(float deltaTime);
+    static void CompareSimplificationCheckVoxels(
+        const AcousticsSimulationConfiguration& config, const AcousticsSimulationConfiguration& checkConfig);
+    void StopSimplificationCheck();
+    void ClearSimplificationCheck();
+    static FString GetSimplificationCheckDir();
+    static bool SimplificationCheckCallback(const char* message, int progress);
     bool ShouldEnableForProcessing() const;
     TOptional<float> GetProgressBarPercent() const;
     EVisibility GetProgressBarVisibility() const;
@@ -131,6 +151,9 @@ private:
     static float m_CurrentProgress;
     static bool m_CancelRequest;
     static bool m_ShowSimulationParameters;
+    static bool m_SimplifyGeometry;
+    static bool m_VerifySimplification;
+    static bool m_CancelSimplificationCheck;
 
     TArray<class AAcousticsProbeVolume*> m_MaterialOverrideVolumes;
     TArray<class AAcousticsProbeVolume*> m_MaterialRemapVolumes;
@@ -138,4 +161,25 @@ private:
     FAcousticsEdMode* m_AcousticsEditMode;
 
     TSharedPtr<SAcousticsSimulationParametersPanel> m_SimParamsPanel;
+
+    // Polls a navigation build started by ComputePrebake, which resumes once it is done
+#if ENGINE_MAJOR_VERSION == 5
+    FTSTicker::FDelegateHandle m_NavigationBuildTicker;
+#else
+    FDelegateHandle m_NavigationBuildTicker;
+#endif
+    int32 m_NavigationBuildTaskCount = 0;
+    bool m_NavigationBuildAttempted = false;
+
+    // Polls the simplification check started by ComputePrebake
+#if ENGINE_MAJOR_VERSION == 5
+    FTSTicker::FDelegateHandle m_SimplificationCheckTicker;
+#else
+    FDelegateHandle m_SimplificationCheckTicker;
+#endif
+    TSharedPtr<AcousticsSimulationConfiguration> m_SimplificationCheckConfig;
+    // The regular configuration the check compares against. Any other configuration means it was cleared. Held so
+    // the comparison can finish reading it even when it's cleared meanwhile.
+    TSharedPtr<const AcousticsSimulationConfiguration> m_SimplificationCheckedConfig;
+    TFuture<void> m_SimplificationCompareFuture;
 };
@@ -219,6 +219,11 @@ const AcousticsSimulationConfiguration* AcousticsSharedState::GetSimulationConfi
     return m_SimulationConfiguration.Get();
 }
 
+TSharedPtr<const AcousticsSimulationConfiguration> AcousticsSharedState::GetSharedSimulationConfiguration()
+{
+    return m_SimulationConfiguration;
+}
+
 // Whether a prebake is in progress, done, or failed
 bool AcousticsSharedState::IsPrebakeActive()
 {
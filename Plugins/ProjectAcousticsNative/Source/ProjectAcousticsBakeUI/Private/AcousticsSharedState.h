@@ -19,6 +19,8 @@ public:
     static const AcousticsMaterialLibrary* GetKnownMaterialsLibrary();
     static void SetKnownMaterialsLibrary(TUniquePtr<AcousticsMaterialLibrary> library);
     static const AcousticsSimulationConfiguration* GetSimulationConfiguration();
+    // Keeps the configuration alive for work that may outlive it being cleared or replaced
+    static TSharedPtr<const AcousticsSimulationConfiguration> GetSharedSimulationConfiguration();
     static bool IsPrebakeActive();
     static void SetSimulationConfiguration(TUniquePtr<AcousticsSimulationConfiguration> config);
     static const FSimulationParameters& GetSimulationParameters();
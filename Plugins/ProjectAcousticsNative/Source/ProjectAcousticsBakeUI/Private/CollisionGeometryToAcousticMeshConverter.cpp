@@ -2,11 +2,13 @@
 // Licensed under the MIT License.
 #ifdef ENABLE_COLLISION_SUPPORT
 #include "CollisionGeometryToAcousticMeshConverter.h"
-#include "AcousticsFbxImporter.h"
-#include "Runtime/Engine/Public/AssetExportTask.h"
-#include "Editor/UnrealEd/Classes/Exporters/ExporterFbx.h"
-#include "Editor/UnrealEd/Classes/Exporters/FbxExportOption.h"
-#include "Editor/UnrealEd/Classes/Exporters/StaticMeshExporterFBX.h"
+#include "AcousticsSharedState.h"
+#include "AcousticsMaterialLibrary.h"
+#include "MathUtils.h"
+#include "Async/ParallelFor.h"
+#include "Components/PrimitiveComponent.h"
+#include "EngineUtils.h"
+#include "PhysicsEngine/BodySetup.h"
 #include "Runtime/Engine/Classes/PhysicalMaterials/PhysicalMaterial.h"
 
 bool CollisionGeometryToAcousticMeshConverter::AddCollisionGeometryToAcousticMesh(AcousticMesh* acousticMesh)
@@ -21,160 +23,347 @@ bool CollisionGeometryToAcousticMeshConverter::AddCollisionGeometryToAcousticMes
         }
     }
 
-    // We rely on UE4 to export the PhysX collision geometry to an intermediate FBX file.
-    // This FBX is then parsed and the geometry from collision nodes (UCX_*) is added
-    // to the acoustic mesh as acoustic geometry.
-    FString fbxFilepath;
-    auto result = ExportCollisionsToFbx(actors, &fbxFilepath);
-    if (result)
+    // Nothing to do, which isn't a failure
+    if (actors.Num() == 0)
     {
-        result = ImportCollisionsFromFbx(acousticMesh, fbxFilepath);
+        return true;
     }
-    return result;
+
+    // The simple collision shapes are read directly from each component's body setup, so there is no
+    // intermediate FBX file to write and parse. Gathering touches UObjects and the material library and stays
+    // on the game thread; the tessellation only works on copies and runs in parallel.
+    TArray<CollisionSource> sources;
+    GatherCollisionSources(actors, sources);
+
+    TArray<CollisionGeometry> geometries;
+    geometries.SetNum(sources.Num());
+    ParallelFor(sources.Num(), [&sources, &geometries](int32 index) {
+        TessellateCollisionSource(sources[index], geometries[index]);
+    });
+
+    for (auto i = 0; i < geometries.Num(); ++i)
+    {
+        auto& geometry = geometries[i];
+        if (geometry.Triangles.Num() == 0)
+        {
+            UE_LOG(
+                LogAcoustics, Warning, TEXT("No supported collision shapes found on %s. Ignoring."), *sources[i].Name);
+            continue;
+        }
+
+        if (!acousticMesh->Add(
+                geometry.Vertices.GetData(),
+                geometry.Vertices.Num(),
+                geometry.Triangles.GetData(),
+                geometry.Triangles.Num(),
+                MeshTypeGeometry))
+        {
+            UE_LOG(LogAcoustics, Error, TEXT("Failed to add collision geometry of %s"), *sources[i].Name);
+            return false;
+        }
+    }
+    return true;
 }
 
-//
-// "Waterfalls" through the material hierarchy and tries to find the most detailed material
-// name for use by the acoustics system.
-//
-// From low to high detail: Default, Material name, Physical Material name, Physical Audio Material name
-// When multiple materials are present, priority is given to whichever gives the most detailed info.
-// In case of the same detail (eg., two materials both providing audio material), we choose
-// the first one.
-FName CollisionGeometryToAcousticMeshConverter::ExtractPhysicalMaterialName(
-    const TArray<UMaterialInterface*>& Materials)
+bool CollisionGeometryToAcousticMeshConverter::BlocksCollision(const UPrimitiveComponent* component)
 {
-    auto chosenQuality = -1;
-    FName chosenName(TEXT("Default_Triton"));
+    if (!component->IsCollisionEnabled())
+    {
+        return false;
+    }
 
-    auto extractNameFromMaterial = [](const UMaterialInterface* material, int* quality) {
-        auto name = material->GetName();
-        *quality = 0;
-        auto physicalMaterial = material->GetPhysicalMaterial();
-        if (physicalMaterial != nullptr && physicalMaterial != GEngine->DefaultPhysMaterial)
+    for (auto channel = 0; channel < ECC_MAX; ++channel)
+    {
+        if (component->GetCollisionResponseToChannel(static_cast<ECollisionChannel>(channel)) == ECR_Block)
         {
-            name = physicalMaterial->GetName();
+            return true;
         }
-        return FName(*name);
-    };
+    }
+    return false;
+}
 
-    for (const auto material : Materials)
+void CollisionGeometryToAcousticMeshConverter::GatherCollisionSources(
+    const TArray<AActor*>& actors, TArray<CollisionSource>& sources)
+{
+    auto materialsLibrary = AcousticsSharedState::GetMaterialsLibrary();
+
+    for (auto actor : actors)
     {
-        if (material)
+        TInlineComponentArray<UPrimitiveComponent*> components(actor);
+        for (auto component : components)
         {
-            auto matchQuality = -1;
-            auto name = extractNameFromMaterial(material, &matchQuality);
-            if (matchQuality > chosenQuality)
+            if (!BlocksCollision(component))
             {
-                chosenQuality = matchQuality;
-                chosenName = name;
+                continue;
             }
+
+            auto bodySetup = component->GetBodySetup();
+            if (bodySetup == nullptr || bodySetup->AggGeom.GetElementCount() == 0)
+            {
+                continue;
+            }
+
+            TArray<UMaterialInterface*> materials;
+            for (auto i = 0; i < component->GetNumMaterials(); ++i)
+            {
+                materials.Add(component->GetMaterial(i));
+            }
+
+            auto materialName = ExtractPhysicalMaterialName(materials);
+            TritonMaterialCode code = TRITON_DEFAULT_WALL_CODE;
+            if (materialsLibrary && !materialsLibrary->FindMaterialCode(materialName.ToString(), &code))
+            {
+                UE_LOG(
+                    LogAcoustics,
+                    Warning,
+                    TEXT("The material %s has no acoustic material mapping, but is used by collision geometry. Using "
+                         "the default code."),
+                    *materialName.ToString());
+                code = TRITON_DEFAULT_WALL_CODE;
+            }
+
+            CollisionSource source;
+            source.AggGeom = bodySetup->AggGeom;
+            source.ComponentTransform = component->GetComponentTransform();
+            source.MaterialCode = code;
+            source.Name = actor->GetActorLabel() + TEXT(".") + component->GetName();
+            sources.Add(MoveTemp(source));
         }
     }
-    return chosenName;
 }
 
-bool CollisionGeometryToAcousticMeshConverter::ExportCollisionsToFbx(
-    const TArray<AActor*>& actors, FString* fbxFilepath)
+void CollisionGeometryToAcousticMeshConverter::TessellateCollisionSource(
+    const CollisionSource& source, CollisionGeometry& geometry)
 {
-    // Nothing to do?
-    if (actors.Num() == 0)
+    const auto& aggGeom = source.AggGeom;
+    for (const auto& box : aggGeom.BoxElems)
     {
-        return false;
+        AddBox(box, source.ComponentTransform, geometry);
+    }
+    for (const auto& sphere : aggGeom.SphereElems)
+    {
+        AddSphere(sphere, source.ComponentTransform, geometry);
+    }
+    for (const auto& capsule : aggGeom.SphylElems)
+    {
+        AddCapsule(capsule, source.ComponentTransform, geometry);
     }
+    for (const auto& capsule : aggGeom.TaperedCapsuleElems)
+    {
+        AddTaperedCapsule(capsule, source.ComponentTransform, geometry);
+    }
+    for (const auto& convex : aggGeom.ConvexElems)
+    {
+        AddConvex(convex, source.ComponentTransform, geometry);
+    }
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+    // Level sets have no surface to tessellate
+    for (auto i = 0; i < aggGeom.LevelSetElems.Num(); ++i)
+    {
+        UE_LOG(
+            LogAcoustics,
+            Warning,
+            TEXT("Level set collision element %d of %s isn't supported as acoustic geometry. Ignoring."),
+            i,
+            *source.Name);
+    }
+#endif
 
-    // Make sure nothing is selected.
-    // We'll mark the passed actors as selected and export to FBX.
-    GEditor->SelectNone(true, true, false);
-    for (auto actor : actors)
+    // All shapes of a component share the same acoustic material
+    for (auto& triangle : geometry.Triangles)
     {
-        // Select the actor for collision goemetry export
-        GEditor->SelectActor(actor, true, false, true, false);
+        triangle.MaterialCode = source.MaterialCode;
     }
+}
 
-    // Export the world with selected actors to a transient FBX under the project's intermediate folder
-    auto world = GEditor->GetEditorWorldContext().World();
-    auto exportTask = NewObject<UAssetExportTask>();
-    exportTask->Exporter = UExporter::FindExporter(world, TEXT("FBX"));
-    if (exportTask->Exporter == nullptr)
+void CollisionGeometryToAcousticMeshConverter::AddBox(
+    const FKBoxElem& box, const FTransform& transform, CollisionGeometry& geometry)
+{
+    const auto elementTransform = box.GetTransform();
+    const FVector extent(box.X * 0.5f, box.Y * 0.5f, box.Z * 0.5f);
+    const auto base = geometry.Vertices.Num();
+    for (auto corner = 0; corner < 8; ++corner)
     {
-        UE_LOG(LogAcoustics, Error, TEXT("FBX exporter not found"));
-        return false;
+        const FVector local(
+            (corner & 1) ? extent.X : -extent.X,
+            (corner & 2) ? extent.Y : -extent.Y,
+            (corner & 4) ? extent.Z : -extent.Z);
+        AddVertex(elementTransform.TransformPosition(local), transform, geometry);
     }
 
-    auto options = NewObject<UFbxExportOption>();
-    options->Collision = true;
-    exportTask->Options = options;
-    exportTask->bAutomated = true;
-    exportTask->bSelected = true;
-    exportTask->bReplaceIdentical = true;
-    exportTask->Object = world;
-    auto filename = world->GetName() + TEXT(".fbx");
-    auto filepath = FPaths::Combine(FPaths::ProjectIntermediateDir(), filename);
-    exportTask->Filename = filepath;
-    exportTask->bAutomated = true;
-    if (UExporter::RunAssetExportTask(exportTask) == false)
-    {
-        UE_LOG(LogAcoustics, Error, TEXT("Failed to export collision meshes to FBX"));
-        return false;
+    // Two triangles per face, corners indexed by their sign bits (X = 1, Y = 2, Z = 4)
+    static const int faces[6][4] = {
+        {0, 2, 3, 1}, {4, 5, 7, 6}, {0, 1, 5, 4}, {2, 6, 7, 3}, {0, 4, 6, 2}, {1, 3, 7, 5}};
+    for (const auto& face : faces)
+    {
+        AddTriangle(base + face[0], base + face[1], base + face[2], geometry);
+        AddTriangle(base + face[0], base + face[2], base + face[3], geometry);
     }
+}
 
-    GEditor->SelectNone(true, true, false);
+void CollisionGeometryToAcousticMeshConverter::AddSphere(
+    const FKSphereElem& sphere, const FTransform& transform, CollisionGeometry& geometry)
+{
+    AddRoundedShape(sphere.Radius, sphere.Radius, 0.0f, FTransform(sphere.Center), transform, geometry);
+}
 
-    // Return the FBX filepath to import from...
-    *fbxFilepath = filepath;
-    return true;
+void CollisionGeometryToAcousticMeshConverter::AddCapsule(
+    const FKSphylElem& capsule, const FTransform& transform, CollisionGeometry& geometry)
+{
+    // Capsule length is the distance between the two hemisphere centers, along the element's Z axis
+    AddRoundedShape(
+        capsule.Radius, capsule.Radius, capsule.Length * 0.5f, capsule.GetTransform(), transform, geometry);
 }
 
-bool CollisionGeometryToAcousticMeshConverter::ImportCollisionsFromFbx(
-    AcousticMesh* acouticsMesh, const FString& fbxFilepath)
+void CollisionGeometryToAcousticMeshConverter::AddTaperedCapsule(
+    const FKTaperedCapsuleElem& capsule, const FTransform& transform, CollisionGeometry& geometry)
 {
-    auto importer = AcousticsFbxImporter::Create();
-    if (!importer)
+    // Radius1 is the upper sphere and Radius0 the lower one. The cone between them is approximated by joining the
+    // two equators, which sits slightly inside the true tangent cone.
+    AddRoundedShape(
+        capsule.Radius1, capsule.Radius0, capsule.Length * 0.5f, capsule.GetTransform(), transform, geometry);
+}
+
+void CollisionGeometryToAcousticMeshConverter::AddConvex(
+    const FKConvexElem& convex, const FTransform& transform, CollisionGeometry& geometry)
+{
+    if (convex.VertexData.Num() < 4)
     {
-        UE_LOG(LogAcoustics, Error, TEXT("Failed to create acoustics FBX importer"));
+        return;
     }
 
-    if (!importer->ParseFbx(fbxFilepath, 1.0f))
+    // Index data is normally cooked with the body setup. Older assets may not have it, so rebuild it on a copy.
+    auto indices = convex.IndexData;
+    if (indices.Num() == 0)
     {
-        UE_LOG(LogAcoustics, Error, TEXT("Could not parse exported collision FBX"));
-        return false;
+        FKConvexElem convexCopy = convex;
+        convexCopy.ComputeChaosConvexIndices(true);
+        indices = convexCopy.IndexData;
     }
 
-    for (const auto& mesh : importer->GetMeshObjects())
+    const auto elementTransform = convex.GetTransform();
+    const auto base = geometry.Vertices.Num();
+    for (const auto& vertex : convex.VertexData)
+    {
+        AddVertex(elementTransform.TransformPosition(vertex), transform, geometry);
+    }
+    for (auto i = 0; i + 2 < indices.Num(); i += 3)
+    {
+        AddTriangle(base + indices[i], base + indices[i + 1], base + indices[i + 2], geometry);
+    }
+}
+
+void CollisionGeometryToAcousticMeshConverter::AddRoundedShape(
+    float topRadius, float bottomRadius, float halfLength, const FTransform& elementTransform,
+    const FTransform& transform, CollisionGeometry& geometry)
+{
+    // Rings go from the top pole to the bottom pole. The upper half is shifted up by halfLength and the lower half
+    // down, which turns the sphere into a capsule and adds the cylinder between the two middle rings.
+    const auto base = geometry.Vertices.Num();
+    AddVertex(elementTransform.TransformPosition(FVector(0.0f, 0.0f, topRadius + halfLength)), transform, geometry);
+    for (auto ring = 1; ring <= c_CollisionSphereRings; ++ring)
     {
-        // Only use the mesh if the prefix matches
-        if (mesh.GetName().StartsWith(c_FbxCollisionPrefix))
+        // The equator ring is duplicated so the capsule's cylinder has its own band of triangles
+        const auto equatorRing = c_CollisionSphereRings / 2;
+        const auto ringIndex = ring <= equatorRing ? ring : ring - 1;
+        const auto offset = ring <= equatorRing ? halfLength : -halfLength;
+        const auto radius = ring <= equatorRing ? topRadius : bottomRadius;
+        const auto theta = PI * ringIndex / c_CollisionSphereRings;
+        const auto ringRadius = radius * FMath::Sin(theta);
+        const auto z = radius * FMath::Cos(theta) + offset;
+        for (auto segment = 0; segment < c_CollisionSphereSegments; ++segment)
         {
-            TArray<ATKVectorF> tritonVertices;
-            for (const auto& v : mesh.GetVertices())
-            {
-                tritonVertices.Add(
-                    ATKVectorF{static_cast<float>(v.X), static_cast<float>(v.Y), static_cast<float>(v.Z)});
-            }
+            const auto phi = 2.0f * PI * segment / c_CollisionSphereSegments;
+            const FVector position(ringRadius * FMath::Cos(phi), ringRadius * FMath::Sin(phi), z);
+            AddVertex(elementTransform.TransformPosition(position), transform, geometry);
+        }
+    }
+    const auto bottom = geometry.Vertices.Num();
+    AddVertex(
+        elementTransform.TransformPosition(FVector(0.0f, 0.0f, -bottomRadius - halfLength)), transform, geometry);
 
-            TArray<TritonAcousticMeshTriangleInformation> tritonTriangles;
-            for (const auto& t : mesh.GetTriangles())
+    auto ringStart = [base](int ring) { return base + 1 + (ring - 1) * c_CollisionSphereSegments; };
+    for (auto segment = 0; segment < c_CollisionSphereSegments; ++segment)
+    {
+        const auto next = (segment + 1) % c_CollisionSphereSegments;
+
+        // Top cap
+        AddTriangle(base, ringStart(1) + next, ringStart(1) + segment, geometry);
+
+        // Bands between rings. For a sphere the two equator rings coincide, so that band is skipped.
+        for (auto ring = 1; ring < c_CollisionSphereRings; ++ring)
+        {
+            if (ring == c_CollisionSphereRings / 2 && halfLength <= 0.0f && topRadius == bottomRadius)
             {
-                TritonAcousticMeshTriangleInformation info;
-                info.Indices = ATKVectorI{t.VertexIndices[0], t.VertexIndices[1], t.VertexIndices[2]};
-                // NOTE: Currently default wall code is used for all collision geometry
-                info.MaterialCode = static_cast<TritonMaterialCode>(TRITON_DEFAULT_WALL_CODE);
-                tritonTriangles.Add(info);
+                continue;
             }
+            const auto upper = ringStart(ring);
+            const auto lower = ringStart(ring + 1);
+            AddTriangle(upper + segment, upper + next, lower + next, geometry);
+            AddTriangle(upper + segment, lower + next, lower + segment, geometry);
+        }
+
+        // Bottom cap
+        const auto last = ringStart(c_CollisionSphereRings);
+        AddTriangle(bottom, last + segment, last + next, geometry);
+    }
+}
+
+void CollisionGeometryToAcousticMeshConverter::AddVertex(
+    const FVector& position, const FTransform& transform, CollisionGeometry& geometry)
+{
+    auto vertex = AcousticsUtils::UnrealPositionToTriton(transform.TransformPosition(position));
+    geometry.Vertices.Add(ATKVectorD{vertex.X, vertex.Y, vertex.Z});
+}
+
+void CollisionGeometryToAcousticMeshConverter::AddTriangle(
+    int index1, int index2, int index3, CollisionGeometry& geometry)
+{
+    TritonAcousticMeshTriangleInformation info;
+    info.Indices = ATKVectorI{index1, index2, index3};
+    info.MaterialCode = static_cast<TritonMaterialCode>(TRITON_DEFAULT_WALL_CODE);
+    geometry.Triangles.Add(info);
+}
 
-            if (TritonPreprocessor_AcousticMesh_Add(
-                    acouticsMesh->GetHandle(),
-                    tritonVertices.GetData(),
-                    tritonVertices.Num(),
-                    tritonTriangles.GetData(),
-                    tritonTriangles.Num(),
-                    MeshTypeGeometry) == false)
+//
+// "Waterfalls" through the material hierarchy and tries to find the most detailed material
+// name for use by the acoustics system.
+//
+// From low to high detail: Default, Material name, Physical Material name, Physical Audio Material name
+// When multiple materials are present, priority is given to whichever gives the most detailed info.
+// In case of the same detail (eg., two materials both providing audio material), we choose
+// the first one.
+FName CollisionGeometryToAcousticMeshConverter::ExtractPhysicalMaterialName(
+    const TArray<UMaterialInterface*>& Materials)
+{
+    auto chosenQuality = -1;
+    FName chosenName(TEXT("Default_Triton"));
+
+    auto extractNameFromMaterial = [](const UMaterialInterface* material, int* quality) {
+        auto name = material->GetName();
+        *quality = 0;
+        auto physicalMaterial = material->GetPhysicalMaterial();
+        if (physicalMaterial != nullptr && physicalMaterial != GEngine->DefaultPhysMaterial)
+        {
+            name = physicalMaterial->GetName();
+        }
+        return FName(*name);
+    };
+
+    for (const auto material : Materials)
+    {
+        if (material)
+        {
+            auto matchQuality = -1;
+            auto name = extractNameFromMaterial(material, &matchQuality);
+            if (matchQuality > chosenQuality)
             {
-                return false;
+                chosenQuality = matchQuality;
+                chosenName = name;
             }
         }
     }
-    return true;
+    return chosenName;
 }
-#endif // ENABLE_COLLISION_SUPPORT
\ No newline at end of file
+
+#endif // ENABLE_COLLISION_SUPPORT
@@ -1,14 +1,17 @@
 // Copyright (c) 2022 Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 #pragma once
+// Only compiled when the module defines ENABLE_COLLISION_SUPPORT, which it doesn't by default
 #ifdef ENABLE_COLLISION_SUPPORT
 #include "AcousticsMesh.h"
+#include "PhysicsEngine/AggregateGeom.h"
 
 // Tag used to mark actors that need to use collision mesh, instead of the render mesh, as the acoustic mesh
 const FName c_AcousticsCollisionTag = "AcousticsCollisionGeometry";
 
-// FBX format uses UCX_ prefix for collision mesh nodes
-const FString c_FbxCollisionPrefix = TEXT("UCX_");
+// Tessellation used for the round collision shapes (spheres, capsules and tapered capsules)
+const int c_CollisionSphereSegments = 16;
+const int c_CollisionSphereRings = 8;
 
 class CollisionGeometryToAcousticMeshConverter final
 {
@@ -17,13 +20,47 @@ public:
     static bool AddCollisionGeometryToAcousticMesh(AcousticMesh* acousticMesh);
 
 private:
+    // Simple collision of one primitive component, copied on the game thread so it can be tessellated in parallel
+    struct CollisionSource
+    {
+        FKAggregateGeom AggGeom;
+        FTransform ComponentTransform;
+        TritonMaterialCode MaterialCode;
+        FString Name;
+    };
+
+    // Tessellated triangles of one collision source, in Triton space
+    struct CollisionGeometry
+    {
+        TArray<ATKVectorD> Vertices;
+        TArray<TritonAcousticMeshTriangleInformation> Triangles;
+    };
+
     static bool HasCollisionTag(AActor* actor)
     {
         return actor->ActorHasTag(c_AcousticsCollisionTag);
     }
 
+    // Triggers, overlap-only components and components with collision turned off aren't solid surfaces
+    static bool BlocksCollision(const class UPrimitiveComponent* component);
+
     static FName ExtractPhysicalMaterialName(const TArray<UMaterialInterface*>& Materials);
-    static bool ExportCollisionsToFbx(const TArray<AActor*>& actors, FString* fbxFilepath);
-    static bool ImportCollisionsFromFbx(AcousticMesh* acouticsMesh, const FString& fbxFilepath);
+    static void GatherCollisionSources(const TArray<AActor*>& actors, TArray<CollisionSource>& sources);
+    static void TessellateCollisionSource(const CollisionSource& source, CollisionGeometry& geometry);
+
+    static void AddBox(const FKBoxElem& box, const FTransform& transform, CollisionGeometry& geometry);
+    static void AddSphere(const FKSphereElem& sphere, const FTransform& transform, CollisionGeometry& geometry);
+    static void AddCapsule(const FKSphylElem& capsule, const FTransform& transform, CollisionGeometry& geometry);
+    static void AddTaperedCapsule(
+        const FKTaperedCapsuleElem& capsule, const FTransform& transform, CollisionGeometry& geometry);
+    static void AddConvex(const FKConvexElem& convex, const FTransform& transform, CollisionGeometry& geometry);
+
+    // Adds a sphere-like shape made of rings, where each hemisphere can be offset along Z and have its own radius
+    // (used for capsules and tapered capsules)
+    static void AddRoundedShape(
+        float topRadius, float bottomRadius, float halfLength, const FTransform& elementTransform,
+        const FTransform& transform, CollisionGeometry& geometry);
+    static void AddVertex(const FVector& position, const FTransform& transform, CollisionGeometry& geometry);
+    static void AddTriangle(int index1, int index2, int index3, CollisionGeometry& geometry);
 };
-#endif // ENABLE_COLLISION_SUPPORT
\ No newline at end of file
+#endif // ENABLE_COLLISION_SUPPORT
@@ -18,6 +18,9 @@
 
 DEFINE_LOG_CATEGORY(LogAcousticsNative)
 
+// Distance (cm) at which a source's query priority is halved
+constexpr float c_QueryPriorityReferenceDistance = 2000.0f;
+
 FAcousticsSourceDataOverride::FAcousticsSourceDataOverride()
     : m_Acoustics(nullptr)
     , m_IsStereoReverbInitialized(false)
@@ -51,6 +54,11 @@ void FAcousticsSourceDataOverride::Initialize(const FAudioPluginInitializationPa
     // Process the reverb settings
     auto settings = GetDefault<UAcousticsSourceDataOverrideSettings>();
 
+    if (m_Acoustics)
+    {
+        m_Acoustics->SetQueryRateLimits(settings->MinQueryRate, settings->MaxQueryRate);
+    }
+
     m_ReverbType = settings->ReverbType;
 
     if (m_ReverbType == EAcousticsReverbType::SpatialReverb)
@@ -339,6 +347,13 @@ void FAcousticsSourceDataOverride::GetSourceDataOverrides(
             InOutWaveInstance->ActiveSound->GetWorld(), sourceLocation, objectParams.Design);
     }
 
+    // Loud sources near the listener keep the highest query rate when the query thread is under load.
+    // Volume already includes distance attenuation, the distance term covers sounds without attenuation settings
+    const float volume =
+        FMath::Clamp(InOutWaveInstance->GetVolumeWithDistanceAndOcclusionAttenuation(), 0.0f, 1.0f);
+    const float distance = FVector::Dist(sourceLocation, listenerLocation);
+    objectParams.QueryPriority = volume / (1.0f + distance / c_QueryPriorityReferenceDistance);
+
     // Run the acoustic query
     bool acousticQuerySuccess =
         m_Acoustics->UpdateObjectParameters(SourceId, sourceLocation, listenerLocation, objectParams);
@@ -473,6 +488,11 @@ void FAcousticsSourceDataOverride::GetSourceDataOverrides(
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
 void FAcousticsSourceDataOverride::OnAllSourcesProcessed()
 {
+    if (m_Acoustics)
+    {
+        m_Acoustics->OnAudioFrameProcessed();
+    }
+
     if (IsSpatialReverbInitialized())
     {
         m_SpatialReverb->ProcessAllSources();
@@ -175,6 +175,24 @@ public:
         meta = (ClampMin = 0.0f, ClampMax = 5.0f, UIMin = 0.0f, UIMax = 5.0f, DisplayName = "Long Reverb Length"))
     float LongReverbLength;
 
+    /**
+     *    Lowest number of acoustic query updates per second for a single sound source. When the query thread can't
+     *    keep up with all playing sources, quiet and distant sources are lowered towards this rate first
+     */
+    UPROPERTY(
+        GlobalConfig, EditAnywhere, Category = "Performance",
+        meta = (ClampMin = 0.1f, ClampMax = 60.0f, UIMin = 0.1f, UIMax = 60.0f, DisplayName = "Min Query Rate"))
+    float MinQueryRate = 2.0f;
+
+    /**
+     *    Highest number of acoustic query updates per second for a single sound source. Loud, nearby sources are
+     *    updated at up to this rate, and all sources are while the query thread has spare capacity
+     */
+    UPROPERTY(
+        GlobalConfig, EditAnywhere, Category = "Performance",
+        meta = (ClampMin = 0.1f, ClampMax = 200.0f, UIMin = 0.1f, UIMax = 200.0f, DisplayName = "Max Query Rate"))
+    float MaxQueryRate = 60.0f;
+
 private:
     void SetReverbBuses(FReverbBusesInfo buses);
 
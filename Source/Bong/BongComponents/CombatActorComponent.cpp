@@ -7,7 +7,7 @@
 #include "Bong/PlayerController/BongPlayerController.h"
 //#include "Bong/HUD/BongHUD.h" 头文件已经包含
 #include "Engine/SkeletalMeshSocket.h"
-#include "GameFramework/CharacterMovementComponent.h"
+#include "Bong/Character/BongCharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "DrawDebugHelpers.h"
 #include "Camera/CameraComponent.h"
@@ -26,7 +26,6 @@ UCombatActorComponent::UCombatActorComponent(const FObjectInitializer& ObjectIni
 	PrimaryComponentTick.bCanEverTick = true;
 
 	BaseWalkSpeed = 600.f;
-	AimWalkSpeed = 450.f;
 }
 
 void UCombatActorComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -92,19 +91,14 @@ void UCombatActorComponent::SetAiming(bool bIsAiming)
 {
 	if(BongCharacter == nullptr || EquippedWeapon == nullptr) return;
 	
-	// 确保客户端先流畅执行<否则要等RPC 将bIsAiming复制回来
+	// 确保客户端先流畅执行<否则要等服务端将bIsAiming复制回来
 	bCompAiming = bIsAiming;
-	
-	// 不用管两端，ServerRPC都是在服务器执行，所以只需确保是不是Owner Controller
-	// 若是主办人，即服务端Server-owned actor 调用ServerRPC，那就只在服务器运行<我发给我自己
-	// 若是本地是客户端，发RPC给自己的RemoteRole = Authority; 服务端上的Client-owned actor内变量发生变化，就会复制给客户端
-	ServerSetAiming(bIsAiming);
 
-	// 等待RPC执行完，先瞄准再移动
-	if(BongCharacter)
-    {
-        BongCharacter->GetCharacterMovement()->MaxWalkSpeed = bIsAiming ? AimWalkSpeed : BaseWalkSpeed;
-    }
+	// 瞄准随下一个移动包的压缩标志发给服务端，两端用同一帧的瞄准状态计算速度，不会产生移动纠正
+	if(UBongCharacterMovementComponent* BongMovement = Cast<UBongCharacterMovementComponent>(BongCharacter->GetCharacterMovement()))
+	{
+		BongMovement->SetWantsToAim(bIsAiming);
+	}
 	// 只需在本地完成
 	if(BongCharacter->IsLocallyControlled() && EquippedWeapon->GetWeaponType() == EWeaponType::EWY_SniperRifle)
 	{
@@ -112,16 +106,6 @@ void UCombatActorComponent::SetAiming(bool bIsAiming)
 	}
 }
 
-void UCombatActorComponent::ServerSetAiming_Implementation(bool bIsAiming)
-{
-	// 该变量的第二次设置，也就是确保只在服务端设置
-	bCompAiming = bIsAiming;
-	if(BongCharacter)
-	{
-		BongCharacter->GetCharacterMovement()->MaxWalkSpeed = bIsAiming ? AimWalkSpeed : BaseWalkSpeed;
-	}
-}
-
 // 模拟代理没有物理输入操作，无法按下按钮，所以永远无法执行这个函数
 void UCombatActorComponent::FireButtonPressed(bool bPressed)
 {
@@ -150,6 +134,8 @@ void UCombatActorComponent::Fire()
 bool UCombatActorComponent::CanFire()
 {
 	if(EquippedWeapon == nullptr) return false;
+	// 装备后的资源还在加载，开火表现会缺，等加载完再允许开火
+	if(!EquippedWeapon->IsAssetBundleLoaded(WeaponAssetBundles::Equipped)) return false;
 
 	     if(!EquippedWeapon->IsEmpty() && bCanFire && CombatState == ECombatState::ECS_Reloading && EquippedWeapon->GetWeaponType() == EWeaponType::EWY_Shotgun)
 	     {
@@ -196,6 +182,38 @@ void UCombatActorComponent::OnRep_SingleCarriedAmmo()
 	}
 }
 
+void UCombatActorComponent::ResetForRespawn()
+{
+	if(BongCharacter == nullptr) return;
+
+	// 武器在 Eliminate 时已经丢掉，这里只断开引用
+	bFireButtonPressed = false;
+	bCanFire = true;
+	GetWorld()->GetTimerManager().ClearTimer(FireTimer);
+
+	if(UBongCharacterMovementComponent* BongMovement = Cast<UBongCharacterMovementComponent>(BongCharacter->GetCharacterMovement()))
+	{
+		BongMovement->SetWantsToAim(false);
+	}
+	BongCharacter->GetCharacterMovement()->MaxWalkSpeed = BaseWalkSpeed;
+
+	// InterpFOV 没有武器时不更新，死前在瞄准的话要手动恢复
+	CurrentFOV = DefaultFOV;
+	if(BongCharacter->IsLocallyControlled() && BongCharacter->GetFollowCamera())
+	{
+		BongCharacter->GetFollowCamera()->SetFieldOfView(DefaultFOV);
+	}
+
+	if(BongCharacter->HasAuthority())
+	{
+		EquippedWeapon = nullptr;
+		bCompAiming = false;
+		CombatState = ECombatState::ECS_Unoccupied;
+		SingleCarriedAmmo = 0;
+		InitializeCarriedAmmo(); // Emplace 会覆盖旧值
+	}
+}
+
 void UCombatActorComponent::InitializeCarriedAmmo()
 {
 	CarriedAmmoMapping.Emplace(EWeaponType::EWY_AssaultRifle, StartingRifleAmmo);
@@ -281,10 +299,7 @@ void UCombatActorComponent::EquipWeapon(AWeapon* WeaponToEquip)
 		BongController->SetHUDCarriedAmmo(SingleCarriedAmmo);
 	}
 	// 服务端执行
-	if(EquippedWeapon->EquippingSound)
-	{
-		UGameplayStatics::PlaySoundAtLocation(this, EquippedWeapon->EquippingSound, BongCharacter->GetActorLocation());
-	}
+	EquippedWeapon->PlayEquippingSound();
 	// 捡起空武器可以自动装填
 	if(EquippedWeapon->IsEmpty())
 	{
@@ -315,10 +330,7 @@ void UCombatActorComponent::OnRep_EquippedWeapon()
 			HandSocket->AttachActor(EquippedWeapon, BongCharacter->GetMesh() );
 		}
 		// 客户端执行
-		if(EquippedWeapon->EquippingSound)
-		{
-			UGameplayStatics::PlaySoundAtLocation(this, EquippedWeapon->EquippingSound, BongCharacter->GetActorLocation());
-		}
+		EquippedWeapon->PlayEquippingSound();
 		
 		BongCharacter->GetCharacterMovement()->bOrientRotationToMovement = false;
 		BongCharacter->bUseControllerRotationYaw = true;
@@ -368,13 +380,12 @@ void UCombatActorComponent::TraceUnderCrosshairs(FHitResult& TraceHitResult)
 		// HitTarget的 线性检测，Visibility Channel
 		GetWorld()->LineTraceSingleByChannel(TraceHitResult, Start, End, ECollisionChannel::ECC_Visibility);
 		// 实现了这个接口的Actor，准星就变红
-		if(TraceHitResult.GetActor() && TraceHitResult.GetActor()->Implements<UInteractCrosshairsInterface>())
-		{
-			HUDPackage.CrosshairsColor = FLinearColor::Red;
-		}
-		else
+		const FLinearColor CrosshairsColor =
+			TraceHitResult.GetActor() && TraceHitResult.GetActor()->Implements<UInteractCrosshairsInterface>() ? FLinearColor::Red : FLinearColor::White;
+		if(HUDPackage.CrosshairsColor != CrosshairsColor)
 		{
-			HUDPackage.CrosshairsColor = FLinearColor::White;
+			HUDPackage.CrosshairsColor = CrosshairsColor;
+			bHUDPackageDirty = true;
 		}
 
 		
@@ -409,74 +420,111 @@ void UCombatActorComponent::SetHUDCrosshairs(float Delta)
 		if(BongHUD)
 		{
 			// 装备的武器决定了 设置纹理结构体的内容
-			if(EquippedWeapon)
-			{
-				HUDPackage.CrosshairsCenter = EquippedWeapon->CrosshairsCenter;
-				HUDPackage.CrosshairsTop = EquippedWeapon->CrosshairsTop;
-				HUDPackage.CrosshairsBottom = EquippedWeapon->CrosshairsBottom;
-				HUDPackage.CrosshairsLeft = EquippedWeapon->CrosshairsLeft;
-				HUDPackage.CrosshairsRight = EquippedWeapon->CrosshairsRight;
-			}
-			else
+			UpdateCrosshairsTextures();
+
+			if(UpdateCrosshairsSpread(Delta))
 			{
-				HUDPackage.CrosshairsCenter = nullptr;
-				HUDPackage.CrosshairsTop = nullptr;
-				HUDPackage.CrosshairsBottom = nullptr;
-				HUDPackage.CrosshairsLeft = nullptr;
-				HUDPackage.CrosshairsRight = nullptr;
+				bHUDPackageDirty = true;
 			}
 			
 			/*
-			 * 计算准星扩散和缩小 crosshairs spread
+			 * 给HUD里的 HUDPackage赋值，只在有变化时推送，HUD 再据此更新准星材质参数
 			 */
-			FVector2D RangeWalkSpeed(0.f, BongCharacter->GetCharacterMovement()->MaxWalkSpeed); // [0, 600] -> [0, 1]
-			FVector2D RangeVelocityMultiplier(0.f, 1.f);
-
-			// 前后左右速度的Value一般 要在RangeWalkSpeed内
-			FVector Velocity = BongCharacter->GetVelocity();
-			Velocity.Z = 0.f;
-			
-			CrosshairsVelocityFactor = FMath::GetMappedRangeValueClamped(RangeWalkSpeed, RangeVelocityMultiplier, Velocity.Size());
-			if(BongCharacter->GetCharacterMovement()->IsFalling())
-			{
-				// 想要空中准星扩展更慢，所以用插值<站立不动时，跳起 Velocity.Size() = 0>
-				CrosshairsInAirFactor = FMath::FInterpTo(CrosshairsInAirFactor, 2.25f, Delta, 2.25f);
-			}
-			else
-			{
-				// 落地 碰到地面时，更快的缩小
-				CrosshairsInAirFactor = FMath::FInterpTo(CrosshairsInAirFactor, 0.f, Delta, 30.f);
-			}
-
-			if(bCompAiming)
-			{
-				CrosshairsAimFactor = FMath::FInterpTo(CrosshairsAimFactor, -0.5f, Delta, 30.f);
-			}
-			else
+			if(bHUDPackageDirty)
 			{
-				CrosshairsAimFactor = FMath::FInterpTo(CrosshairsAimFactor, 0.f, Delta, 30.f);
+				bHUDPackageDirty = false;
+				BongHUD->SetHUDPackage(HUDPackage);
 			}
-			
-			// 射击时，准星瞬间扩大，之后更快速恢复
-			CrosshairsShootingFactor = FMath::FInterpTo(CrosshairsShootingFactor, 0.f, Delta, 40.f);
-			
-			/** 充分实现移动时跳跃，扩展更大;  站立不动时，跳起 Velocity.Size() = 0 */
-			HUDPackage.CrosshairsSpread =
-				0.5f/*抵消不动时的瞄准缩小*/ +
-				CrosshairsVelocityFactor +
-				CrosshairsInAirFactor +
-				CrosshairsAimFactor +
-				CrosshairsShootingFactor;
-			
-			
-			/*
-			 * 给HUD里的 HUDPackage赋值，实时改变
-			 */
-			BongHUD->SetHUDPackage(HUDPackage);
 		}
 	}
 }
 
+void UCombatActorComponent::UpdateCrosshairsTextures()
+{
+	if(CrosshairsWeapon.Get() == EquippedWeapon && !bCrosshairsTexturesPending) return;
+	CrosshairsWeapon = EquippedWeapon;
+
+	if(EquippedWeapon)
+	{
+		HUDPackage.CrosshairsCenter = EquippedWeapon->CrosshairsCenter.Get();
+		HUDPackage.CrosshairsTop = EquippedWeapon->CrosshairsTop.Get();
+		HUDPackage.CrosshairsBottom = EquippedWeapon->CrosshairsBottom.Get();
+		HUDPackage.CrosshairsLeft = EquippedWeapon->CrosshairsLeft.Get();
+		HUDPackage.CrosshairsRight = EquippedWeapon->CrosshairsRight.Get();
+
+		// FirstPerson 资源包还在异步加载时，加载完成前继续检查
+		bCrosshairsTexturesPending =
+			EquippedWeapon->CrosshairsCenter.IsPending() ||
+			EquippedWeapon->CrosshairsTop.IsPending() ||
+			EquippedWeapon->CrosshairsBottom.IsPending() ||
+			EquippedWeapon->CrosshairsLeft.IsPending() ||
+			EquippedWeapon->CrosshairsRight.IsPending();
+	}
+	else
+	{
+		HUDPackage.CrosshairsCenter = nullptr;
+		HUDPackage.CrosshairsTop = nullptr;
+		HUDPackage.CrosshairsBottom = nullptr;
+		HUDPackage.CrosshairsLeft = nullptr;
+		HUDPackage.CrosshairsRight = nullptr;
+		bCrosshairsTexturesPending = false;
+	}
+	bHUDPackageDirty = true;
+}
+
+/*
+ * 计算准星扩散和缩小 crosshairs spread，返回扩散是否变化
+ * 速度、是否在空中、是否瞄准都没变，并且插值都已到位、没有射击后坐时直接跳过
+ */
+bool UCombatActorComponent::UpdateCrosshairsSpread(float Delta)
+{
+	// 前后左右速度的Value一般 要在RangeWalkSpeed内
+	FVector Velocity = BongCharacter->GetVelocity();
+	Velocity.Z = 0.f;
+	const float Speed = Velocity.Size();
+	const bool bFalling = BongCharacter->GetCharacterMovement()->IsFalling();
+
+	const float InAirTarget = bFalling ? 2.25f : 0.f;
+	const float AimTarget = bCompAiming ? -0.5f : 0.f;
+	const bool bInputsUnchanged = Speed == LastCrosshairsSpeed && bFalling == bLastCrosshairsFalling && bCompAiming == bLastCrosshairsAiming;
+	if(bInputsUnchanged && CrosshairsInAirFactor == InAirTarget && CrosshairsAimFactor == AimTarget && CrosshairsShootingFactor == 0.f)
+	{
+		return false;
+	}
+	LastCrosshairsSpeed = Speed;
+	bLastCrosshairsFalling = bFalling;
+	bLastCrosshairsAiming = bCompAiming;
+
+	FVector2D RangeWalkSpeed(0.f, BongCharacter->GetCharacterMovement()->GetMaxSpeed()); // [0, 600] -> [0, 1]
+	FVector2D RangeVelocityMultiplier(0.f, 1.f);
+	CrosshairsVelocityFactor = FMath::GetMappedRangeValueClamped(RangeWalkSpeed, RangeVelocityMultiplier, Speed);
+
+	// 想要空中准星扩展更慢，所以用插值<站立不动时，跳起 Velocity.Size() = 0>；落地 碰到地面时，更快的缩小
+	CrosshairsInAirFactor = FMath::FInterpTo(CrosshairsInAirFactor, InAirTarget, Delta, bFalling ? 2.25f : 30.f);
+	CrosshairsAimFactor = FMath::FInterpTo(CrosshairsAimFactor, AimTarget, Delta, 30.f);
+	// 射击时，准星瞬间扩大，之后更快速恢复
+	CrosshairsShootingFactor = FMath::FInterpTo(CrosshairsShootingFactor, 0.f, Delta, 40.f);
+
+	// 插值足够接近时直接到位，之后才能跳过计算
+	if(FMath::IsNearlyEqual(CrosshairsInAirFactor, InAirTarget, 0.01f)) CrosshairsInAirFactor = InAirTarget;
+	if(FMath::IsNearlyEqual(CrosshairsAimFactor, AimTarget, 0.01f)) CrosshairsAimFactor = AimTarget;
+	if(CrosshairsShootingFactor < 0.01f) CrosshairsShootingFactor = 0.f;
+	
+	/** 充分实现移动时跳跃，扩展更大;  站立不动时，跳起 Velocity.Size() = 0 */
+	const float CrosshairsSpread =
+		0.5f/*抵消不动时的瞄准缩小*/ +
+		CrosshairsVelocityFactor +
+		CrosshairsInAirFactor +
+		CrosshairsAimFactor +
+		CrosshairsShootingFactor;
+	if(CrosshairsSpread == HUDPackage.CrosshairsSpread)
+	{
+		return false;
+	}
+	HUDPackage.CrosshairsSpread = CrosshairsSpread;
+	return true;
+}
+
 
 void UCombatActorComponent::Reload()
 {
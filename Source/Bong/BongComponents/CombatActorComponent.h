@@ -25,6 +25,7 @@ public:
 	UCombatActorComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 	
 	friend class ABongCharacter; //友元类
+	friend class UBongCharacterMovementComponent; // 服务端从移动包同步 bCompAiming
 	
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
@@ -43,13 +44,13 @@ public:
 
 	void JumpToShotgunEnd();
 
+	// 复用 Pawn 重生时调用，各端都会执行，服务端额外重置复制变量和携带弹药
+	void ResetForRespawn();
+
 protected:
 	virtual void BeginPlay() override;
 	void SetAiming(bool bIsAiming);
 
-	// RPC不像Rep_Notify，是可以有参数的
-	UFUNCTION(Server, Reliable)
-	void ServerSetAiming(bool bIsAiming);
 	UFUNCTION()
 	void OnRep_EquippedWeapon();
 
@@ -83,10 +84,9 @@ private:
 	UPROPERTY(Replicated)
 	bool bCompAiming;
 
+	// 瞄准时的速度在 UBongCharacterMovementComponent 里
 	UPROPERTY(EditAnywhere)
 	float BaseWalkSpeed;
-	UPROPERTY(EditAnywhere)
-	float AimWalkSpeed;
 
 	bool bFireButtonPressed;
 
@@ -101,6 +101,18 @@ private:
 	FVector HitTarget;
 
 	FHUDPackage HUDPackage;
+	// HUDPackage 有变化时才推给 HUD
+	bool bHUDPackageDirty = true;
+	// 纹理只在换武器或软引用加载完成时重新拷贝
+	TWeakObjectPtr<AWeapon> CrosshairsWeapon;
+	bool bCrosshairsTexturesPending = false;
+	// 上一次计算扩散时的输入，输入不变且各项插值都到位后跳过计算
+	float LastCrosshairsSpeed = -1.f;
+	bool bLastCrosshairsFalling = false;
+	bool bLastCrosshairsAiming = false;
+
+	void UpdateCrosshairsTextures();
+	bool UpdateCrosshairsSpread(float Delta);
 	
 	/*
 	 * Aiming and FOV
@@ -6,7 +6,7 @@
 #include "Camera/CameraComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Components/WidgetComponent.h"
-#include "GameFramework/CharacterMovementComponent.h"
+#include "BongCharacterMovementComponent.h"
 #include "Bong/Weapon/Weapon.h"
 #include "Bong/BongComponents/CombatActorComponent.h"
 #include "Components/CapsuleComponent.h"
@@ -21,6 +21,9 @@
 #include "Kismet/GameplayStatics.h"
 #include "Bong/PlayerState/BongPlayerState.h"
 #include "Bong/Weapon/WeaponTypes.h"
+#include "Bong/Weapon/WeaponPickupSubsystem.h"
+#include "Bong/Weapon/ImpactFXSubsystem.h"
+#include "Bong/Weapon/ImpactAudioSubsystem.h"
 // 定义 DOREPLIFETIME 的生命周期
 #include "Net/UnrealNetwork.h"
 // Enhanced Input
@@ -32,7 +35,7 @@
 class UEnhancedInputLocalPlayerSubsystem;
 // Sets default values
 ABongCharacter::ABongCharacter(const FObjectInitializer& ObjectInitializer)
-	: Super(ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UBongCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	PrimaryActorTick.bCanEverTick = true;
 	Combat = CreateDefaultSubobject<UCombatActorComponent>(TEXT("CombatActorComp"));
@@ -172,6 +175,7 @@ void ABongCharacter::BeginPlay()
 	if(HasAuthority())
 	{
 		OnTakeAnyDamage.AddDynamic(this, &ABongCharacter::ReceiveDamage);
+		GetWorldTimerManager().SetTimer(PickupQueryTimer, this, &ABongCharacter::UpdateOverlappingWeapon, PickupQueryInterval, true);
 	}
 }
 
@@ -580,7 +584,11 @@ void ABongCharacter::MulticastEliminate_Implementation()
 		// 如果蓝图已配置，且值传递有效
         if(DissolveMaterialInstance)
         {
-            DynamicDissolveMaterialInstances[MeshElementIndex] = UMaterialInstanceDynamic::Create(DissolveMaterialInstance, this);
+        	// Pawn 会被复用，动态材质实例只创建一次
+        	if(DynamicDissolveMaterialInstances[MeshElementIndex] == nullptr)
+        	{
+        		DynamicDissolveMaterialInstances[MeshElementIndex] = UMaterialInstanceDynamic::Create(DissolveMaterialInstance, this);
+        	}
      
             // 给模型上材质，这一步很重要
             GetMesh()->SetMaterial(MeshElementIndex, DynamicDissolveMaterialInstances[MeshElementIndex]);
@@ -618,14 +626,24 @@ void ABongCharacter::MulticastEliminate_Implementation()
 	
 	
 	// Spawn eliminate bot
-	if(ElimBotVFX)
+	FVector ElimBotSpawnPoint(GetActorLocation().X, GetActorLocation().Y, GetActorLocation().Z + 200.f);
+	if(ElimBotDataChannel)
+	{
+		if(UImpactFXSubsystem* ImpactFX = GetWorld()->GetSubsystem<UImpactFXSubsystem>())
+		{
+			ImpactFX->AddImpact(ElimBotDataChannel, ElimBotSpawnPoint, GetActorForwardVector());
+		}
+	}
+	else if(ElimBotVFX)
 	{
-		FVector ElimBotSpawnPoint(GetActorLocation().X, GetActorLocation().Y, GetActorLocation().Z + 200.f);
 		ElimBotComp = UGameplayStatics::SpawnEmitterAtLocation(this, ElimBotVFX, ElimBotSpawnPoint, GetActorRotation());
 	}
 	if(ElimBotSound)
 	{
-		UGameplayStatics::SpawnSoundAtLocation(this, ElimBotSound, GetActorLocation());
+		if(UImpactAudioSubsystem* ImpactAudio = GetWorld()->GetSubsystem<UImpactAudioSubsystem>())
+		{
+			ImpactAudio->PlaySound(ElimBotSound, GetActorLocation(), EImpactAudioCategory::Elim);
+		}
 	}
 
 	// 正在用狙击枪 瞄准的人被杀死时
@@ -635,6 +653,81 @@ void ABongCharacter::MulticastEliminate_Implementation()
 	}
 }
 
+void ABongCharacter::Respawn(const FTransform& SpawnTransform)
+{
+	GetWorldTimerManager().ClearTimer(ElimTimer);
+
+	Health = MaxHealth;
+	bDisableGameplay = false;
+
+	MulticastRespawn();
+
+	// 出生点被占用时找不到空位，就直接放上去，和 AdjustIfPossibleButAlwaysSpawn 一致
+	const FRotator SpawnRotation(0.f, SpawnTransform.Rotator().Yaw, 0.f);
+	if(!TeleportTo(SpawnTransform.GetLocation(), SpawnRotation))
+	{
+		TeleportTo(SpawnTransform.GetLocation(), SpawnRotation, false, true);
+	}
+	if(Controller)
+	{
+		Controller->ClientSetRotation(SpawnRotation);
+	}
+	
+	UpdateHUDHealth();
+}
+
+// 撤销 MulticastEliminate 里的所有改动，恢复到 CDO 的状态
+void ABongCharacter::MulticastRespawn_Implementation()
+{
+	const ABongCharacter* DefaultCharacter = GetClass()->GetDefaultObject<ABongCharacter>();
+	
+	bEliminated = false;
+	bDisableGameplay = false;
+	TurningInPlace = ETurningInPlace::ETIP_NotTurning;
+
+	if(UAnimInstance* AnimInstance = GetMesh()->GetAnimInstance())
+	{
+		AnimInstance->StopAllMontages(0.f);
+	}
+
+	// 换回原来的材质，动态材质实例留着下次淘汰时再用
+	if(DissolveTimeline)
+	{
+		DissolveTimeline->Stop();
+	}
+	for(int32 MeshElementIndex = 0; MeshElementIndex < GetMesh()->GetNumMaterials(); ++MeshElementIndex)
+	{
+		GetMesh()->SetMaterial(MeshElementIndex, DefaultCharacter->GetMesh()->GetMaterial(MeshElementIndex));
+	}
+
+	if(ElimBotComp)
+	{
+		ElimBotComp->DestroyComponent();
+		ElimBotComp = nullptr;
+	}
+
+	GetCapsuleComponent()->SetCollisionEnabled(DefaultCharacter->GetCapsuleComponent()->GetCollisionEnabled());
+	GetMesh()->SetCollisionEnabled(DefaultCharacter->GetMesh()->GetCollisionEnabled());
+
+	// 未装备武器时的设置，EquippedWeapon 复制为空时 OnRep 不会处理
+	GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+	GetCharacterMovement()->bOrientRotationToMovement = DefaultCharacter->GetCharacterMovement()->bOrientRotationToMovement;
+	bUseControllerRotationYaw = DefaultCharacter->bUseControllerRotationYaw;
+
+	if(Combat)
+	{
+		Combat->ResetForRespawn();
+	}
+
+	BongPlayerController = BongPlayerController == nullptr ? Cast<ABongPlayerController>(Controller) : BongPlayerController;
+	if(BongPlayerController && IsLocallyControlled())
+	{
+		EnableInput(BongPlayerController);
+		BongPlayerController->SetHUDWeaponAmmo(0);
+		BongPlayerController->SetHUDCarriedAmmo(0);
+	}
+}
+
 // 该函数只在服务端调用
 void ABongCharacter::ElimTimerFinished()
 {
@@ -649,19 +742,26 @@ void ABongCharacter::UpdateDissolveMaterialInstance(float DissolveValueOutput)
 {
 	for(UMaterialInstanceDynamic* DynamicDissolveMaterialInstance : DynamicDissolveMaterialInstances)
 	{
-		DynamicDissolveMaterialInstance->SetScalarParameterValue(TEXT("Dissolve"), DissolveValueOutput);
+		if(DynamicDissolveMaterialInstance)
+		{
+			DynamicDissolveMaterialInstance->SetScalarParameterValue(TEXT("Dissolve"), DissolveValueOutput);
+		}
 	}
 }
 
 void ABongCharacter::StartDissolve()
 {
-	InterpFunc_DissolveTimelineTrack.BindDynamic(this, &ABongCharacter::UpdateDissolveMaterialInstance);
-	
 	if(FloatCurve_DissolveAsset && DissolveTimeline)
 	{
-		// Timeline在相应类型的轨道委托上使用曲线资产，回调会把曲线上读取的值输出
-		DissolveTimeline->AddInterpFloat(FloatCurve_DissolveAsset, InterpFunc_DissolveTimelineTrack);
-		DissolveTimeline->Play();
+		// 轨道只添加一次，复用 Pawn 时重复添加会让回调执行多遍
+		if(!InterpFunc_DissolveTimelineTrack.IsBound())
+		{
+			InterpFunc_DissolveTimelineTrack.BindDynamic(this, &ABongCharacter::UpdateDissolveMaterialInstance);
+			
+			// Timeline在相应类型的轨道委托上使用曲线资产，回调会把曲线上读取的值输出
+			DissolveTimeline->AddInterpFloat(FloatCurve_DissolveAsset, InterpFunc_DissolveTimelineTrack);
+		}
+		DissolveTimeline->PlayFromStart();
 	}
 }
 
@@ -848,12 +948,16 @@ void ABongCharacter::HideCameraIfCharacterClose()
 }
 
 // 只在客户端执行，Health若没有更新，此处就不会执行
-void ABongCharacter::OnRep_Health()
+void ABongCharacter::OnRep_Health(float LastHealth)
 {
 	UpdateHUDHealth();
 	
 	// 使用服务端的变量复制， 再Rep_Notify 来替代 多播RPC
-	PlayHitReactMontage();
+	// 重生回满血时不播放受击
+	if(Health < LastHealth)
+	{
+		PlayHitReactMontage();
+	}
 }
 
 void ABongCharacter::UpdateHUDHealth()
@@ -919,6 +1023,27 @@ void ABongCharacter::SetOverlappingWeapon(AWeapon* Weapon)
 	}
 }
 
+// 只在服务端调用
+void ABongCharacter::UpdateOverlappingWeapon()
+{
+	UWeaponPickupSubsystem* PickupSubsystem = GetWorld()->GetSubsystem<UWeaponPickupSubsystem>();
+	if(PickupSubsystem == nullptr) return;
+
+	const FVector Location = GetActorLocation();
+	if(PickupSubsystem->GetVersion() == LastPickupQueryVersion && FVector::DistSquared(Location, LastPickupQueryLocation) < FMath::Square(PickupQueryMinDistance))
+	{
+		return;
+	}
+	LastPickupQueryVersion = PickupSubsystem->GetVersion();
+	LastPickupQueryLocation = Location;
+
+	AWeapon* NearestWeapon = bEliminated ? nullptr : PickupSubsystem->FindNearestWeapon(Location, GetCapsuleComponent()->GetScaledCapsuleRadius(), GetCapsuleComponent()->GetScaledCapsuleHalfHeight());
+	if(NearestWeapon != OverlappingWeapon)
+	{
+		SetOverlappingWeapon(NearestWeapon);
+	}
+}
+
 // Rep_Notify只在客户端运行 C++版；且变量开启复制后才会调用
 void ABongCharacter::OnRep_OverlappingWeapon(AWeapon* LastWeapon)
 {
@@ -20,6 +20,7 @@ class ABongPlayerController;
 class ABongGameMode;
 class UParticleSystem;
 class UParticleSystemComponent;
+class UNiagaraDataChannelAsset;
 class USoundCue;
 class ABongPlayerState;
 // EnhancedInput
@@ -46,6 +47,11 @@ public:
 	void Eliminate();
 	UFUNCTION(NetMulticast, Reliable)
 	void MulticastEliminate();
+
+	// 只在服务端调用，原地复用这个 Pawn 重生，不再 Destroy 后重新生成
+	void Respawn(const FTransform& SpawnTransform);
+	UFUNCTION(NetMulticast, Reliable)
+	void MulticastRespawn();
 	
 	//UFUNCTION(NetMulticast, Unreliable)
 	//void MulticastHitReact();
@@ -117,6 +123,18 @@ private:
 	UFUNCTION()
 	void OnRep_OverlappingWeapon(AWeapon* LastWeapon);
 
+	// 服务端定时从 UWeaponPickupSubsystem 查询附近的武器，代替武器上的交叠球体
+	void UpdateOverlappingWeapon();
+	FTimerHandle PickupQueryTimer;
+	FVector LastPickupQueryLocation = FVector(BIG_NUMBER);
+	uint32 LastPickupQueryVersion = 0;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Pickup")
+	float PickupQueryInterval = 0.1f;
+	// 没移动这么远，且没有武器被丢下或捡起时，不重新查询
+	UPROPERTY(EditDefaultsOnly, Category = "Pickup")
+	float PickupQueryMinDistance = 10.f;
+
 
 	/*
 	 * Bong Components
@@ -171,7 +189,7 @@ private:
 	UPROPERTY(ReplicatedUsing = OnRep_Health, VisibleAnywhere, Category = "Player Stats")
 	float Health = 100.f;
 	UFUNCTION()
-	void OnRep_Health();
+	void OnRep_Health(float LastHealth);
 	UPROPERTY()
 	ABongPlayerController* BongPlayerController;
 
@@ -210,6 +228,9 @@ private:
 	 */
 	UPROPERTY(EditAnywhere)
 	TObjectPtr<UParticleSystem> ElimBotVFX;
+	// 设置后淘汰特效写入 UImpactFXSubsystem，不再生成 ElimBotComp
+	UPROPERTY(EditAnywhere)
+	TObjectPtr<UNiagaraDataChannelAsset> ElimBotDataChannel;
 
 	// 没有反射，但不用担心垃圾回收
 	TObjectPtr<UParticleSystemComponent> ElimBotComp;
@@ -0,0 +1,114 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "BongCharacterMovementComponent.h"
+#include "BongCharacter.h"
+#include "Bong/BongComponents/CombatActorComponent.h"
+#include "GameFramework/Character.h"
+
+
+UBongCharacterMovementComponent::UBongCharacterMovementComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+	, bWantsToAim(false)
+{
+}
+
+void UBongCharacterMovementComponent::SetWantsToAim(bool bInWantsToAim)
+{
+	bWantsToAim = bInWantsToAim;
+}
+
+float UBongCharacterMovementComponent::GetMaxSpeed() const
+{
+	if(bWantsToAim && IsMovingOnGround())
+	{
+		return IsCrouching() ? FMath::Min(AimWalkSpeedCrouched, MaxWalkSpeedCrouched) : AimWalkSpeed;
+	}
+	return Super::GetMaxSpeed();
+}
+
+void UBongCharacterMovementComponent::UpdateFromCompressedFlags(uint8 Flags)
+{
+	Super::UpdateFromCompressedFlags(Flags);
+
+	bWantsToAim = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+
+	// 服务端收到移动包时同步瞄准状态，bCompAiming 再复制给模拟代理播放动画
+	ABongCharacter* BongCharacter = Cast<ABongCharacter>(CharacterOwner);
+	UCombatActorComponent* Combat = BongCharacter ? BongCharacter->GetCombat() : nullptr;
+	if(Combat && BongCharacter->HasAuthority())
+	{
+		Combat->bCompAiming = bWantsToAim;
+	}
+}
+
+FNetworkPredictionData_Client* UBongCharacterMovementComponent::GetPredictionData_Client() const
+{
+	if(ClientPredictionData == nullptr)
+	{
+		UBongCharacterMovementComponent* MutableThis = const_cast<UBongCharacterMovementComponent*>(this);
+		MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_Bong(*this);
+	}
+	return ClientPredictionData;
+}
+
+/*
+ * SavedMove
+ */
+void UBongCharacterMovementComponent::FSavedMove_Bong::Clear()
+{
+	Super::Clear();
+
+	bSavedWantsToAim = false;
+}
+
+uint8 UBongCharacterMovementComponent::FSavedMove_Bong::GetCompressedFlags() const
+{
+	uint8 Result = Super::GetCompressedFlags();
+	if(bSavedWantsToAim)
+	{
+		Result |= FLAG_Custom_0;
+	}
+	return Result;
+}
+
+bool UBongCharacterMovementComponent::FSavedMove_Bong::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+	// 瞄准切换的那一帧不能和前面的移动合并，否则服务端会用错速度回放
+	if(bSavedWantsToAim != static_cast<FSavedMove_Bong*>(NewMove.Get())->bSavedWantsToAim)
+	{
+		return false;
+	}
+	return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void UBongCharacterMovementComponent::FSavedMove_Bong::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+	Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+	if(const UBongCharacterMovementComponent* MovementComponent = Cast<UBongCharacterMovementComponent>(C->GetCharacterMovement()))
+	{
+		bSavedWantsToAim = MovementComponent->bWantsToAim;
+	}
+}
+
+void UBongCharacterMovementComponent::FSavedMove_Bong::PrepMoveFor(ACharacter* C)
+{
+	Super::PrepMoveFor(C);
+
+	// 收到纠正后重放旧移动时，恢复当时的瞄准状态
+	if(UBongCharacterMovementComponent* MovementComponent = Cast<UBongCharacterMovementComponent>(C->GetCharacterMovement()))
+	{
+		MovementComponent->bWantsToAim = bSavedWantsToAim;
+	}
+}
+
+UBongCharacterMovementComponent::FNetworkPredictionData_Client_Bong::FNetworkPredictionData_Client_Bong(const UCharacterMovementComponent& ClientMovement)
+	: Super(ClientMovement)
+{
+}
+
+FSavedMovePtr UBongCharacterMovementComponent::FNetworkPredictionData_Client_Bong::AllocateNewMove()
+{
+	return FSavedMovePtr(new FSavedMove_Bong());
+}
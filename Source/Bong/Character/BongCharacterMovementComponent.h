@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "BongCharacterMovementComponent.generated.h"
+
+/**
+ * 瞄准作为 SavedMove 的压缩标志随移动一起发给服务端，服务端回放时用同样的速度，不再需要单独的 ServerRPC
+ */
+UCLASS()
+class BONG_API UBongCharacterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+	class FSavedMove_Bong : public FSavedMove_Character
+	{
+	public:
+		typedef FSavedMove_Character Super;
+
+		virtual void Clear() override;
+		virtual uint8 GetCompressedFlags() const override;
+		virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+		virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+		virtual void PrepMoveFor(ACharacter* C) override;
+
+		uint8 bSavedWantsToAim : 1;
+	};
+
+	class FNetworkPredictionData_Client_Bong : public FNetworkPredictionData_Client_Character
+	{
+	public:
+		typedef FNetworkPredictionData_Client_Character Super;
+
+		FNetworkPredictionData_Client_Bong(const UCharacterMovementComponent& ClientMovement);
+
+		virtual FSavedMovePtr AllocateNewMove() override;
+	};
+
+public:
+	UBongCharacterMovementComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+	virtual float GetMaxSpeed() const override;
+
+	// 只在本地控制端调用，服务端从移动包里的标志得到
+	void SetWantsToAim(bool bInWantsToAim);
+	FORCEINLINE bool WantsToAim() const { return bWantsToAim; }
+
+	UPROPERTY(EditAnywhere, Category = "Character Movement: Walking")
+	float AimWalkSpeed = 450.f;
+	UPROPERTY(EditAnywhere, Category = "Character Movement: Walking")
+	float AimWalkSpeedCrouched = 200.f;
+
+protected:
+	virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+
+private:
+	uint8 bWantsToAim : 1;
+};
@@ -154,6 +154,21 @@ void ABongGameMode::RequestRespawn(ACharacter* EliminatedCharacter, AController*
             	}
             }
 		}
+
+		// 复用 Pawn：Controller 依旧 Possess 着它，不需要重新走生成和初始化流程
+		ABongCharacter* BongCharacter = Cast<ABongCharacter>(EliminatedCharacter);
+		if(bReusePawnOnRespawn && BongCharacter && EliminatedController && EliminatedController->GetPawn() == BongCharacter)
+		{
+			if(StartSpot == nullptr)
+			{
+				StartSpot = FindPlayerStart(EliminatedController);
+			}
+			if(StartSpot)
+			{
+				BongCharacter->Respawn(StartSpot->GetActorTransform());
+				return;
+			}
+		}
 		
 		// 告知即将销毁，让Controller可以Repossess另一个Pawn< 可能是设置好CDO >
 		EliminatedCharacter->Reset();
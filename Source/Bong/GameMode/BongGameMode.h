@@ -37,6 +37,10 @@ public:
 	UPROPERTY(EditDefaultsOnly)
 	float CooldownTime = 10.f;
 
+	// 重生时原地复用被淘汰的 Pawn，避免每次死亡都重新生成角色带来的卡顿和 GC
+	UPROPERTY(EditDefaultsOnly)
+	bool bReusePawnOnRespawn = true;
+
 	// 在 GM内部的 BeginPlay初始化，获取更新
 	// 外部得不到更新，在很早期可能为 0
 	float LevelStartingTime = 0.f;
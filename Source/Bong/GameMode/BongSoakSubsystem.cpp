@@ -0,0 +1,178 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "BongSoakSubsystem.h"
+#include "BongGameMode.h"
+#include "Bong/Character/BongCharacter.h"
+#include "Bong/BongComponents/CombatActorComponent.h"
+#include "Engine/NetDriver.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformMisc.h"
+#include "Misc/CommandLine.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+
+DEFINE_LOG_CATEGORY(BongSoak);
+
+CSV_DEFINE_CATEGORY(BongSoak, true);
+
+
+bool UBongSoakSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return Super::ShouldCreateSubsystem(Outer) && FParse::Param(FCommandLine::Get(), TEXT("BongSoak"));
+}
+
+void UBongSoakSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// 服务端只在死斗地图上跑，Lobby 只负责凑够人数后 ServerTravel
+	bIsServer = InWorld.GetNetMode() != NM_Client;
+	if(bIsServer && !InWorld.GetAuthGameMode<ABongGameMode>())
+	{
+		return;
+	}
+
+	FParse::Value(FCommandLine::Get(), TEXT("BongSoakDuration="), Duration);
+	FParse::Value(FCommandLine::Get(), TEXT("BongSoakMaxFrameMs="), MaxFrameMs);
+	FParse::Value(FCommandLine::Get(), TEXT("BongSoakMaxOutKBps="), MaxOutKBps);
+
+	bRunning = true;
+	ElapsedTime = 0.f;
+
+	if(bIsServer)
+	{
+#if CSV_PROFILER
+		FCsvProfiler::Get()->BeginCapture();
+#endif
+		UE_LOG(BongSoak, Display, TEXT("Soak started: %.0fs, max frame %.2fms, max out %.1fKB/s"), Duration, MaxFrameMs, MaxOutKBps);
+	}
+}
+
+void UBongSoakSubsystem::Deinitialize()
+{
+	// 服务端地图切换或提前退出时也要把已有数据写出去，客户端跟随 ServerTravel 到新地图继续跑
+	if(bRunning && bIsServer)
+	{
+		FinishSoak();
+	}
+	bRunning = false;
+
+	Super::Deinitialize();
+}
+
+void UBongSoakSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if(!bRunning)
+	{
+		return;
+	}
+
+	ElapsedTime += DeltaTime;
+
+	if(bIsServer)
+	{
+		TickServer(DeltaTime);
+	}
+	else
+	{
+		TickBot(DeltaTime);
+	}
+
+	if(ElapsedTime >= Duration)
+	{
+		FinishSoak();
+	}
+}
+
+TStatId UBongSoakSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UBongSoakSubsystem, STATGROUP_Tickables);
+}
+
+void UBongSoakSubsystem::TickServer(float DeltaTime)
+{
+	// 专用服务器会按固定帧率休眠，DeltaTime 不代表开销，用上一帧游戏线程的实际耗时
+	const float FrameMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+	++NumFrames;
+	TotalFrameMs += FrameMs;
+	PeakFrameMs = FMath::Max(PeakFrameMs, FrameMs);
+
+	// NetDriver 每秒更新一次速率统计
+	BandwidthSampleTime += DeltaTime;
+	UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+	if(NetDriver && BandwidthSampleTime >= 1.f)
+	{
+		BandwidthSampleTime = 0.f;
+
+		const float OutKBps = NetDriver->OutBytesPerSecond / 1024.f;
+		++NumBandwidthSamples;
+		TotalOutKBps += OutKBps;
+		PeakOutKBps = FMath::Max(PeakOutKBps, OutKBps);
+
+		CSV_CUSTOM_STAT(BongSoak, OutKBps, OutKBps, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(BongSoak, NumClients, NetDriver->ClientConnections.Num(), ECsvCustomStatOp::Set);
+	}
+}
+
+void UBongSoakSubsystem::TickBot(float DeltaTime)
+{
+	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	ABongCharacter* BongCharacter = PlayerController ? Cast<ABongCharacter>(PlayerController->GetPawn()) : nullptr;
+	if(!BongCharacter || BongCharacter->IsEliminated() || BongCharacter->GetDisableGameplay())
+	{
+		return;
+	}
+
+	// 绕圈跑动，同时慢慢转向，让射击方向不断变化
+	const float Yaw = FMath::Fmod(ElapsedTime * 45.f, 360.f);
+	PlayerController->SetControlRotation(FRotator(0.f, Yaw, 0.f));
+	BongCharacter->AddMovementInput(FRotator(0.f, Yaw + 90.f, 0.f).Vector(), 1.f);
+
+	// 每两秒切换一次开火，覆盖连发和单发
+	BotFireToggleTime += DeltaTime;
+	UCombatActorComponent* Combat = BongCharacter->GetCombat();
+	if(Combat && BotFireToggleTime >= 2.f)
+	{
+		BotFireToggleTime = 0.f;
+		bBotFiring = !bBotFiring;
+		Combat->FireButtonPressed(bBotFiring);
+	}
+}
+
+void UBongSoakSubsystem::FinishSoak()
+{
+	bRunning = false;
+
+	if(!bIsServer)
+	{
+		FPlatformMisc::RequestExitWithStatus(false, 0);
+		return;
+	}
+
+#if CSV_PROFILER
+	FCsvProfiler::Get()->EndCapture();
+#endif
+
+	const float AvgFrameMs = NumFrames > 0 ? TotalFrameMs / NumFrames : 0.f;
+	const float AvgOutKBps = NumBandwidthSamples > 0 ? TotalOutKBps / NumBandwidthSamples : 0.f;
+
+	UE_LOG(BongSoak, Display, TEXT("Soak finished after %.0fs: frame avg %.2fms peak %.2fms, out avg %.1fKB/s peak %.1fKB/s"),
+		ElapsedTime, AvgFrameMs, PeakFrameMs, AvgOutKBps, PeakOutKBps);
+
+	bool bFailed = false;
+	if(MaxFrameMs > 0.f && AvgFrameMs > MaxFrameMs)
+	{
+		UE_LOG(BongSoak, Error, TEXT("Average frame time %.2fms exceeds %.2fms"), AvgFrameMs, MaxFrameMs);
+		bFailed = true;
+	}
+	if(MaxOutKBps > 0.f && AvgOutKBps > MaxOutKBps)
+	{
+		UE_LOG(BongSoak, Error, TEXT("Average outgoing bandwidth %.1fKB/s exceeds %.1fKB/s"), AvgOutKBps, MaxOutKBps);
+		bFailed = true;
+	}
+
+	FPlatformMisc::RequestExitWithStatus(false, bFailed ? 1 : 0);
+}
@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BongSoakSubsystem.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(BongSoak, Log, All);
+
+/**
+ * Headless network soak run for the ABongGameMode deathmatch loop, only created with -BongSoak on the command line.
+ *
+ * Dedicated server:
+ *   Bong <BongMap> -server -nullrhi -log -BongSoak -BongSoakDuration=300 -BongSoakMaxFrameMs=16 -BongSoakMaxOutKBps=512
+ * Bot clients, as many as needed:
+ *   Bong 127.0.0.1 -game -nullrhi -nosound -log -BongSoak -BongSoakDuration=300
+ *
+ * The server captures a CSV profile for the whole run, tracks game thread time and outgoing bandwidth, and exits with
+ * a non-zero code when an average exceeds its threshold. Clients move and fire with scripted input through
+ * UCombatActorComponent and exit once the run is over. The server run ends early if the match restarts, so keep the
+ * duration within WarmupTime + MatchTime.
+ */
+UCLASS()
+class BONG_API UBongSoakSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	void TickServer(float DeltaTime);
+	void TickBot(float DeltaTime);
+	void FinishSoak();
+
+	bool bRunning = false;
+	bool bIsServer = false;
+
+	float Duration = 300.f;
+	// 0 disables the threshold
+	float MaxFrameMs = 0.f;
+	float MaxOutKBps = 0.f;
+
+	float ElapsedTime = 0.f;
+
+	// Server stats
+	int32 NumFrames = 0;
+	double TotalFrameMs = 0.0;
+	float PeakFrameMs = 0.f;
+
+	float BandwidthSampleTime = 0.f;
+	int32 NumBandwidthSamples = 0;
+	double TotalOutKBps = 0.0;
+	float PeakOutKBps = 0.f;
+
+	// Bot input
+	float BotFireToggleTime = 0.f;
+	bool bBotFiring = false;
+};
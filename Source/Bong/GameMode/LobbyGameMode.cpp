@@ -3,6 +3,7 @@
 
 #include "LobbyGameMode.h"
 #include "GameFramework/GameStateBase.h"
+#include "Kismet/GameplayStatics.h"
 
 
 ALobbyGameMode::ALobbyGameMode(const FObjectInitializer& ObjectInitializer)
@@ -10,18 +11,25 @@ ALobbyGameMode::ALobbyGameMode(const FObjectInitializer& ObjectInitializer)
 {
 }
 
+void ALobbyGameMode::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
+{
+	Super::InitGame(MapName, Options, ErrorMessage);
+
+	NumPlayersToTravel = UGameplayStatics::GetIntOption(Options, TEXT("TravelPlayers"), NumPlayersToTravel);
+}
+
 void ALobbyGameMode::PostLogin(APlayerController* NewPlayer)
 {
 	Super::PostLogin(NewPlayer);
 
 	int32 NumberOfPlayer = GameState.Get()->PlayerArray.Num();
-	if(NumberOfPlayer == 2)
+	if(NumberOfPlayer == NumPlayersToTravel)
 	{
 		UWorld* World = GetWorld();
 		if(World)
 		{
 			bUseSeamlessTravel = true;
-			World->ServerTravel(FString("/Game/Bong/Maps/TempMulti_WhiteBox_OW?listen"));
+			World->ServerTravel(MatchMapURL);
 		}
 	}
 }
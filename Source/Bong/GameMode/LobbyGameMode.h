@@ -17,6 +17,15 @@ class BONG_API ALobbyGameMode : public AGameMode
 public:
 	ALobbyGameMode(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 	
+	virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
 	virtual void PostLogin(APlayerController* NewPlayer) override;
+
+protected:
+	// Players needed before travelling to the match map. Can be overridden with ?TravelPlayers=N, e.g. for soak runs
+	UPROPERTY(EditDefaultsOnly)
+	int32 NumPlayersToTravel = 2;
+
+	UPROPERTY(EditDefaultsOnly)
+	FString MatchMapURL = TEXT("/Game/Bong/Maps/TempMulti_WhiteBox_OW?listen");
 	
 };
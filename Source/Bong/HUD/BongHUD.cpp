@@ -6,6 +6,8 @@
 #include "Announcement.h"
 #include "CharacterOverlay.h"
 #include "GameFramework/PlayerController.h"
+#include "Engine/UserInterfaceSettings.h"
+#include "Materials/MaterialInstanceDynamic.h"
 
 DEFINE_LOG_CATEGORY(BongHUD);
 
@@ -26,6 +28,13 @@ void ABongHUD::DrawHUD()
 		GEngine->GameViewport->GetViewportSize(ViewportSize);
 		// 纹理绘制点 以视口中心为基准
 		const FVector2D ViewportCenter(ViewportSize.X/2.f, ViewportSize.Y/2.f);
+
+		if(CrosshairsMaterial)
+		{
+			DrawCrosshairsMaterial(ViewportSize, ViewportCenter);
+			return;
+		}
+		
 		// 基本不变的值设为const
 		float SpreadScaled = CrosshairsSpreadMax * HUDPackage.CrosshairsSpread;
 		
@@ -57,6 +66,23 @@ void ABongHUD::DrawHUD()
 	}
 }
 
+void ABongHUD::SetHUDPackage(const FHUDPackage& Package)
+{
+	if(HUDPackage.CrosshairsCenter != Package.CrosshairsCenter ||
+		HUDPackage.CrosshairsTop != Package.CrosshairsTop ||
+		HUDPackage.CrosshairsBottom != Package.CrosshairsBottom ||
+		HUDPackage.CrosshairsLeft != Package.CrosshairsLeft ||
+		HUDPackage.CrosshairsRight != Package.CrosshairsRight)
+	{
+		bCrosshairsTexturesDirty = true;
+	}
+	if(HUDPackage.CrosshairsSpread != Package.CrosshairsSpread || HUDPackage.CrosshairsColor != Package.CrosshairsColor)
+	{
+		bCrosshairsParamsDirty = true;
+	}
+	HUDPackage = Package;
+}
+
 void ABongHUD::BeginPlay()
 {
 	Super::BeginPlay();
@@ -85,6 +111,57 @@ void ABongHUD::AddAnnouncement()
 	}
 }
 
+void ABongHUD::DrawCrosshairsMaterial(FVector2D ViewportSize, FVector2D ViewportCenter)
+{
+	// 没装备武器时不画
+	if(HUDPackage.CrosshairsCenter == nullptr && HUDPackage.CrosshairsTop == nullptr && HUDPackage.CrosshairsBottom == nullptr &&
+		HUDPackage.CrosshairsLeft == nullptr && HUDPackage.CrosshairsRight == nullptr)
+	{
+		return;
+	}
+
+	if(CrosshairsMaterialInstance == nullptr)
+	{
+		CrosshairsMaterialInstance = UMaterialInstanceDynamic::Create(CrosshairsMaterial, this);
+		bCrosshairsTexturesDirty = true;
+		bCrosshairsParamsDirty = true;
+	}
+	UpdateCrosshairsMaterial();
+
+	// 和 UMG 用同一条 DPI 曲线，分辨率变化时准星和其它界面一起缩放
+	// 扩散也按同样比例放大，所以材质里的 UV 扩散不受影响
+	const float DPIScale = GetDefault<UUserInterfaceSettings>()->GetDPIScaleBasedOnSize(FIntPoint(ViewportSize.X, ViewportSize.Y));
+	const float DrawSize = CrosshairsMaterialSize * DPIScale;
+
+	DrawMaterialSimple(
+		CrosshairsMaterialInstance,
+		ViewportCenter.X - DrawSize / 2.f,
+		ViewportCenter.Y - DrawSize / 2.f,
+		DrawSize,
+		DrawSize);
+}
+
+void ABongHUD::UpdateCrosshairsMaterial()
+{
+	if(bCrosshairsTexturesDirty)
+	{
+		bCrosshairsTexturesDirty = false;
+		CrosshairsMaterialInstance->SetTextureParameterValue(TEXT("CrosshairsCenter"), HUDPackage.CrosshairsCenter);
+		CrosshairsMaterialInstance->SetTextureParameterValue(TEXT("CrosshairsTop"), HUDPackage.CrosshairsTop);
+		CrosshairsMaterialInstance->SetTextureParameterValue(TEXT("CrosshairsBottom"), HUDPackage.CrosshairsBottom);
+		CrosshairsMaterialInstance->SetTextureParameterValue(TEXT("CrosshairsLeft"), HUDPackage.CrosshairsLeft);
+		CrosshairsMaterialInstance->SetTextureParameterValue(TEXT("CrosshairsRight"), HUDPackage.CrosshairsRight);
+	}
+	if(bCrosshairsParamsDirty)
+	{
+		bCrosshairsParamsDirty = false;
+		// 像素换算到绘制区域的 UV
+		const float SpreadUV = CrosshairsSpreadMax * HUDPackage.CrosshairsSpread / CrosshairsMaterialSize;
+		CrosshairsMaterialInstance->SetScalarParameterValue(TEXT("CrosshairsSpread"), SpreadUV);
+		CrosshairsMaterialInstance->SetVectorParameterValue(TEXT("CrosshairsColor"), HUDPackage.CrosshairsColor);
+	}
+}
+
 void ABongHUD::DrawCrosshairs(UTexture2D* Texture, FVector2D ViewportCenter, FVector2D Spread, FLinearColor CrosshairsColor)
 {
 	const float TextureWidth = Texture->GetSizeX();
@@ -13,6 +13,8 @@ class UUserWidget;
 class UCharacterOverlay;
 class UAnnouncement;
 class UTexture2D;
+class UMaterialInterface;
+class UMaterialInstanceDynamic;
 
 
 USTRUCT(BlueprintType)
@@ -32,8 +34,8 @@ public:
 	UPROPERTY(Transient)
 	UTexture2D* CrosshairsRight = nullptr;
 
-	float CrosshairsSpread;
-	FLinearColor CrosshairsColor;
+	float CrosshairsSpread = 0.f;
+	FLinearColor CrosshairsColor = FLinearColor::White;
 };
 
 UCLASS()
@@ -69,14 +71,34 @@ protected:
 private:
 	FHUDPackage HUDPackage;
 	void DrawCrosshairs(UTexture2D* Texture, FVector2D ViewportCenter, FVector2D Spread, FLinearColor CrosshairsColor);
+	void DrawCrosshairsMaterial(FVector2D ViewportSize, FVector2D ViewportCenter);
+	void UpdateCrosshairsMaterial();
 
 	UPROPERTY(EditAnywhere)
 	float CrosshairsSpreadMax = 16.f;
 
+	/**
+	 * 准星材质：五张纹理按 Spread 在 UV 里偏移后合成，整个准星只有一次 DrawMaterial
+	 * 参数：CrosshairsCenter/Top/Bottom/Left/Right(Texture)、CrosshairsSpread(Scalar，UV 单位)、CrosshairsColor(Vector)
+	 * 没有设置材质时退回到逐张 DrawTexture；目前项目里还没有这个材质，默认仍走 DrawTexture，材质做好并在 HUD 蓝图里指定后才生效
+	 */
+	UPROPERTY(EditAnywhere, Category = Crosshairs)
+	UMaterialInterface* CrosshairsMaterial = nullptr;
+	UPROPERTY(Transient)
+	UMaterialInstanceDynamic* CrosshairsMaterialInstance = nullptr;
+
+	// 材质绘制区域的边长（DPI 缩放为 1 时的像素），要能容纳纹理加上最大扩散，绘制时按视口的 DPI 缩放
+	UPROPERTY(EditAnywhere, Category = Crosshairs)
+	float CrosshairsMaterialSize = 128.f;
+
+	// HUDPackage 变化后才更新材质参数
+	bool bCrosshairsTexturesDirty = true;
+	bool bCrosshairsParamsDirty = true;
+
 	
 public:
-	// 引用传参，绑定外部值，实时改变
-	FORCEINLINE void SetHUDPackage(const FHUDPackage& Package) { HUDPackage = Package; }
+	// 只在内容变化时调用，这里比较后标记需要更新的材质参数
+	void SetHUDPackage(const FHUDPackage& Package);
 	
 };
 
@@ -0,0 +1,17 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "BongHUDViewModel.h"
+
+
+FText FBongHUDViewModel::FormatCountdown(int32 SecondsLeft)
+{
+	if(SecondsLeft < 0)
+	{
+		return FText();
+	}
+
+	const int32 Minutes = SecondsLeft / 60;
+	const int32 Seconds = SecondsLeft % 60;
+	return FText::FromString(FString::Printf(TEXT("%02d:%02d"), Minutes, Seconds));
+}
@@ -0,0 +1,55 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// 需要刷新到控件上的 HUD 字段
+enum class EBongHUDDirtyFlags : uint8
+{
+	None					= 0,
+	Health					= 1 << 0,
+	Score					= 1 << 1,
+	Defeats					= 1 << 2,
+	WeaponAmmo				= 1 << 3,
+	CarriedAmmo				= 1 << 4,
+	MatchCountdown			= 1 << 5,
+	AnnouncementCountdown	= 1 << 6,
+
+	CharacterOverlay		= Health | Score | Defeats | WeaponAmmo | CarriedAmmo | MatchCountdown,
+	All						= CharacterOverlay | AnnouncementCountdown
+};
+ENUM_CLASS_FLAGS(EBongHUDDirtyFlags);
+
+/**
+ * HUD 上显示的数值，只在数值变化时标脏，ABongPlayerController 每帧统一刷新一次控件
+ * 控件还没创建时脏标记会一直保留，创建后自动补上，不再需要单独缓存初始化用的值
+ * 控件只在真正变化时才 SetText，UCharacterOverlay 可以放在 InvalidationBox / RetainerBox 下面
+ */
+struct FBongHUDViewModel
+{
+	float Health = 0.f;
+	float MaxHealth = 0.f;
+	int32 Score = 0;
+	int32 Defeats = 0;
+	int32 WeaponAmmo = 0;
+	int32 CarriedAmmo = 0;
+	// 剩余秒数，小于 0 时不显示
+	int32 MatchSecondsLeft = -1;
+	int32 AnnouncementSecondsLeft = -1;
+
+	EBongHUDDirtyFlags DirtyFlags = EBongHUDDirtyFlags::None;
+
+	template<typename T>
+	void SetValue(T& Value, T NewValue, EBongHUDDirtyFlags Flag)
+	{
+		if(Value != NewValue)
+		{
+			Value = NewValue;
+			DirtyFlags |= Flag;
+		}
+	}
+
+	// mm:ss
+	static FText FormatCountdown(int32 SecondsLeft);
+};
@@ -2,8 +2,43 @@
 
 
 #include "CharacterOverlay.h"
+#include "Components/ProgressBar.h"
+#include "Components/TextBlock.h"
 
 UCharacterOverlay::UCharacterOverlay(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
 }
+
+void UCharacterOverlay::ApplyHUDViewModel(const FBongHUDViewModel& ViewModel, EBongHUDDirtyFlags Flags)
+{
+	const FNumberFormattingOptions& NumberFormat = FNumberFormattingOptions::DefaultNoGrouping();
+
+	if(EnumHasAnyFlags(Flags, EBongHUDDirtyFlags::Health) && HealthBar && HealthText)
+	{
+		HealthBar->SetPercent(ViewModel.MaxHealth > 0.f ? ViewModel.Health / ViewModel.MaxHealth : 0.f);
+
+		FString HealthString = FString::Printf(TEXT("%d/%d"), FMath::CeilToInt(ViewModel.Health), FMath::CeilToInt(ViewModel.MaxHealth));
+		HealthText->SetText(FText::FromString(HealthString));
+	}
+	if(EnumHasAnyFlags(Flags, EBongHUDDirtyFlags::Score) && ScoreAmount)
+	{
+		ScoreAmount->SetText(FText::AsNumber(ViewModel.Score, &NumberFormat));
+	}
+	if(EnumHasAnyFlags(Flags, EBongHUDDirtyFlags::Defeats) && DefeatsAmount)
+	{
+		DefeatsAmount->SetText(FText::AsNumber(ViewModel.Defeats, &NumberFormat));
+	}
+	if(EnumHasAnyFlags(Flags, EBongHUDDirtyFlags::WeaponAmmo) && WeaponAmmoAmount)
+	{
+		WeaponAmmoAmount->SetText(FText::AsNumber(ViewModel.WeaponAmmo, &NumberFormat));
+	}
+	if(EnumHasAnyFlags(Flags, EBongHUDDirtyFlags::CarriedAmmo) && CarriedAmmoAmount)
+	{
+		CarriedAmmoAmount->SetText(FText::AsNumber(ViewModel.CarriedAmmo, &NumberFormat));
+	}
+	if(EnumHasAnyFlags(Flags, EBongHUDDirtyFlags::MatchCountdown) && MatchCountdownText)
+	{
+		MatchCountdownText->SetText(FBongHUDViewModel::FormatCountdown(ViewModel.MatchSecondsLeft));
+	}
+}
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "BongHUDViewModel.h"
 #include "CharacterOverlay.generated.h"
 
 
@@ -17,6 +18,9 @@ class BONG_API UCharacterOverlay : public UUserWidget
 public:
 	UCharacterOverlay(const FObjectInitializer& ObjectInitializer);
 
+	// 只刷新标脏的控件
+	void ApplyHUDViewModel(const FBongHUDViewModel& ViewModel, EBongHUDDirtyFlags Flags);
+
 	
 	UPROPERTY(meta = (BindWidget))
 	UProgressBar* HealthBar;
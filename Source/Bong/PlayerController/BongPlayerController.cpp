@@ -13,7 +13,6 @@
 #include "Bong/HUD/BongHUD.h"
 #include "Bong/HUD/CharacterOverlay.h"
 #include "Bong/PlayerState/BongPlayerState.h"
-#include "Components/ProgressBar.h"
 #include "Components/TextBlock.h"
 #include "GameFramework/GameMode.h"
 #include "Kismet/GameplayStatics.h"
@@ -85,15 +84,14 @@ void ABongPlayerController::Tick(float DeltaSeconds)
 {
 	Super::Tick(DeltaSeconds);
 	
-	SetHUDTime();
-	
 	CheckTimeSync(DeltaSeconds); // 5秒设置一次
 
-	PollInit();
-	
+	// 服务端上其他玩家的 PC 没有 HUD
 	if(IsLocalController())
 	{
-		//UE_LOG(BongPC, Display, TEXT("IsLocalController tick true: %f"), GetWorld()->GetTimeSeconds());
+		SetHUDTime();
+		PollInit();
+		FlushHUDViewModel();
 	}
 }
 
@@ -327,33 +325,26 @@ void ABongPlayerController::PollInit()
 	// 	}
 	// }
 
-	// 重复检查 负责两端的 血条UI初始化 ？
-	if (ToolCharacterOverlay == nullptr)
+	// 控件（重新）创建后，把 ViewModel 里已有的值全部刷新上去
+	BongHUD = BongHUD == nullptr ? Cast<ABongHUD>(GetHUD()) : BongHUD;
+	if(BongHUD == nullptr) return;
+
+	if(ToolCharacterOverlay != BongHUD->CharacterOverlay)
 	{
-		if (BongHUD && BongHUD->CharacterOverlay)
+		ToolCharacterOverlay = BongHUD->CharacterOverlay;
+		HUDViewModel.DirtyFlags |= EBongHUDDirtyFlags::CharacterOverlay;
+
+		// 客户端 Character 的 BeginPlay 可能早于 Controller 复制，那时的血量没能设置进来
+		if(ABongCharacter* BongCharacter = Cast<ABongCharacter>(GetPawn()))
 		{
-			ToolCharacterOverlay = BongHUD->CharacterOverlay;
-			if(ToolCharacterOverlay)
-			{
-				// 服务于 服务端
-				if(bInitializeHealth) SetHUDHealth(HUDHealth, HUDMaxHealth);
-				// 服务于 客户端
-				//if(!HasAuthority() && GetLocalRole() > ENetRole::ROLE_SimulatedProxy) // 多此一举，客户端只有一个PC
-				if(!HasAuthority())
-				{
-					ABongCharacter* BongCharacter = Cast<ABongCharacter>(GetPawn());
-                    if(BongCharacter)
-                    {
-                    	SetHUDHealth(BongCharacter->GetHealth(), BongCharacter->GetMaxHealth());
-                    }
-				}
-				
-				// 服务于 两端
-				if(bInitializeScore) SetHUDScore(HUDScore);
-				if(bInitializeDefeats) SetHUDDefeats(HUDDefeats);
-			}
+			SetHUDHealth(BongCharacter->GetHealth(), BongCharacter->GetMaxHealth());
 		}
 	}
+	if(ToolAnnouncement != BongHUD->Announcement)
+	{
+		ToolAnnouncement = BongHUD->Announcement;
+		HUDViewModel.DirtyFlags |= EBongHUDDirtyFlags::AnnouncementCountdown;
+	}
 }
 
 
@@ -392,13 +383,6 @@ void ABongPlayerController::SetHUDTime()
 		// 可能一帧得上下时间差，WarmupTime=0 且GetServerTime  比LevelStartingTime 大导致出现负数
 		int32 SecondsLeft = FMath::CeilToInt(TimeLeft);
 		
-		if(WarmupTime > 1 && temp0)
-		{
-			temp0 = false;
-			UE_LOG(LogTemp, Warning, TEXT("---------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------"));
-		}
-		UE_LOG(LogTemp, Warning, TEXT("WarmupTime: %f, GetServerTime(): %f, LevelStartingTime: %f"), WarmupTime, GetServerTime(), LevelStartingTime);
-		
 		if(HasAuthority())
 		{
 			// 目前的机制，最后一名玩家加入大厅后，会立即进入BongMap，所有的逻辑从进入BongMap开始算起
@@ -426,123 +410,61 @@ void ABongPlayerController::SetHUDTime()
 	}
 }
 
+// 以下只更新 HUDViewModel，控件在 FlushHUDViewModel 里每帧统一刷新
 void ABongPlayerController::SetHUDHealth(float Health, float MaxHealth)
 {
-	BongHUD = BongHUD == nullptr ? Cast<ABongHUD>(GetHUD()) : BongHUD;
-	
-	if(BongHUD && BongHUD->CharacterOverlay && BongHUD->CharacterOverlay->HealthBar && BongHUD->CharacterOverlay->HealthText)
-	{
-		float PercentHealth = Health / MaxHealth;
-		BongHUD->CharacterOverlay->HealthBar->SetPercent(PercentHealth);
-		
-		FString HealthText = FString::Printf(TEXT("%d/%d"), FMath::CeilToInt(Health), FMath::CeilToInt(MaxHealth));
-		BongHUD->CharacterOverlay->HealthText->SetText(FText::FromString(HealthText));
-	}
-	else
-	{
-		//UE_LOG(BongPC, Display, TEXT("HUDHealth222: %f, Time: %f"), Health, GetWorld()->GetTimeSeconds());
-		
-		// 代表设置失败了，交给Tick
-		bInitializeHealth = true;
-		HUDHealth = Health;
-		HUDMaxHealth = MaxHealth;
-	}
+	HUDViewModel.SetValue(HUDViewModel.Health, Health, EBongHUDDirtyFlags::Health);
+	HUDViewModel.SetValue(HUDViewModel.MaxHealth, MaxHealth, EBongHUDDirtyFlags::Health);
 }
 
 void ABongPlayerController::SetHUDScore(float Score)
 {
-	BongHUD = BongHUD == nullptr ? Cast<ABongHUD>(GetHUD()) : BongHUD;
-
-	if(BongHUD && BongHUD->CharacterOverlay && BongHUD->CharacterOverlay->ScoreAmount)
-	{
-		FString ScoreText = FString::Printf(TEXT("%d"), FMath::FloorToInt(Score));
-		BongHUD->CharacterOverlay->ScoreAmount->SetText(FText::FromString(ScoreText));
-	}
-	else
-	{
-		// 代表设置失败了，交给Tick
-		bInitializeScore = true;
-		HUDScore = Score;
-	}
+	HUDViewModel.SetValue(HUDViewModel.Score, FMath::FloorToInt(Score), EBongHUDDirtyFlags::Score);
 }
 
 void ABongPlayerController::SetHUDDefeats(int32 Defeats)
 {
-	BongHUD = BongHUD == nullptr ? Cast<ABongHUD>(GetHUD()) : BongHUD;
-
-	if(BongHUD && BongHUD->CharacterOverlay && BongHUD->CharacterOverlay->DefeatsAmount)
-	{
-		FString DefeatsText = FString::Printf(TEXT("%d"), Defeats);
-		BongHUD->CharacterOverlay->DefeatsAmount->SetText(FText::FromString(DefeatsText));
-	}
-	else
-	{
-		// 代表设置失败了，交给Tick
-		bInitializeDefeats = true;
-		HUDDefeats = Defeats;
-	}
+	HUDViewModel.SetValue(HUDViewModel.Defeats, Defeats, EBongHUDDirtyFlags::Defeats);
 }
 
 void ABongPlayerController::SetHUDWeaponAmmo(int32 WeaponAmmo)
 {
-	BongHUD = BongHUD == nullptr ? Cast<ABongHUD>(GetHUD()) : BongHUD;
-
-	if(BongHUD && BongHUD->CharacterOverlay && BongHUD->CharacterOverlay->WeaponAmmoAmount)
-	{
-		FString AmmoText = FString::Printf(TEXT("%d"), WeaponAmmo);
-		BongHUD->CharacterOverlay->WeaponAmmoAmount->SetText(FText::FromString(AmmoText));
-	}
+	HUDViewModel.SetValue(HUDViewModel.WeaponAmmo, WeaponAmmo, EBongHUDDirtyFlags::WeaponAmmo);
 }
 
 void ABongPlayerController::SetHUDCarriedAmmo(int32 CarriedAmmo)
 {
-	BongHUD = BongHUD == nullptr ? Cast<ABongHUD>(GetHUD()) : BongHUD;
-
-	if(BongHUD && BongHUD->CharacterOverlay && BongHUD->CharacterOverlay->CarriedAmmoAmount)
-	{
-		FString CarriedAmmoText = FString::Printf(TEXT("%d"), CarriedAmmo);
-		BongHUD->CharacterOverlay->CarriedAmmoAmount->SetText(FText::FromString(CarriedAmmoText));
-	}
+	HUDViewModel.SetValue(HUDViewModel.CarriedAmmo, CarriedAmmo, EBongHUDDirtyFlags::CarriedAmmo);
 }
 
 void ABongPlayerController::SetHUDMatchCountdown(float MatchTimeLeft)
 {
-	BongHUD = BongHUD == nullptr ? Cast<ABongHUD>(GetHUD()) : BongHUD;
-
-	if(BongHUD && BongHUD->CharacterOverlay && BongHUD->CharacterOverlay->MatchCountdownText)
-	{
-		if(MatchTimeLeft < 0.f)
-		{
-			BongHUD->CharacterOverlay->MatchCountdownText->SetText(FText());
-			return;
-		}
-		
-		int32 Minutes = FMath::FloorToInt(MatchTimeLeft / 60.f);
-		int32 Seconds = MatchTimeLeft - Minutes * 60;
-
-		FString MatchTimeText = FString::Printf(TEXT("%02d:%02d"), Minutes, Seconds);
-		BongHUD->CharacterOverlay->MatchCountdownText->SetText(FText::FromString(MatchTimeText));
-	}
+	const int32 SecondsLeft = MatchTimeLeft < 0.f ? -1 : FMath::FloorToInt(MatchTimeLeft);
+	HUDViewModel.SetValue(HUDViewModel.MatchSecondsLeft, SecondsLeft, EBongHUDDirtyFlags::MatchCountdown);
 }
 
 void ABongPlayerController::SetHUDAnnouncementCountdown(float AnnouncementTimeLeft)
 {
-	BongHUD = BongHUD == nullptr ? Cast<ABongHUD>(GetHUD()) : BongHUD;
+	const int32 SecondsLeft = AnnouncementTimeLeft < 0.f ? -1 : FMath::FloorToInt(AnnouncementTimeLeft);
+	HUDViewModel.SetValue(HUDViewModel.AnnouncementSecondsLeft, SecondsLeft, EBongHUDDirtyFlags::AnnouncementCountdown);
+}
 
-	if(BongHUD && BongHUD->Announcement && BongHUD->Announcement->WarmupTimeText)
+// 一帧只刷新一次，控件还没创建的字段保持脏标记，等创建后再刷新
+void ABongPlayerController::FlushHUDViewModel()
+{
+	if(HUDViewModel.DirtyFlags == EBongHUDDirtyFlags::None || BongHUD == nullptr) return;
+
+	const EBongHUDDirtyFlags OverlayFlags = HUDViewModel.DirtyFlags & EBongHUDDirtyFlags::CharacterOverlay;
+	if(BongHUD->CharacterOverlay && OverlayFlags != EBongHUDDirtyFlags::None)
 	{
-		if(AnnouncementTimeLeft < 0.f)
-		{
-			//BongHUD->Announcement->WarmupTimeText->SetText(FText::FromString(FString::Printf(TEXT("fallout76: %f"), AnnouncementTimeLeft)));
-			BongHUD->Announcement->WarmupTimeText->SetText(FText());
-			return;
-		}
-		
-		int32 Minutes = FMath::FloorToInt(AnnouncementTimeLeft / 60.f);
-		int32 Seconds = AnnouncementTimeLeft - Minutes * 60;
+		BongHUD->CharacterOverlay->ApplyHUDViewModel(HUDViewModel, OverlayFlags);
+		HUDViewModel.DirtyFlags &= ~OverlayFlags;
+	}
 
-		FString WarmupText = FString::Printf(TEXT("%02d:%02d"), Minutes, Seconds);
-		BongHUD->Announcement->WarmupTimeText->SetText(FText::FromString(WarmupText));
+	if(BongHUD->Announcement && BongHUD->Announcement->WarmupTimeText && EnumHasAnyFlags(HUDViewModel.DirtyFlags, EBongHUDDirtyFlags::AnnouncementCountdown))
+	{
+		BongHUD->Announcement->WarmupTimeText->SetText(FBongHUDViewModel::FormatCountdown(HUDViewModel.AnnouncementSecondsLeft));
+		HUDViewModel.DirtyFlags &= ~EBongHUDDirtyFlags::AnnouncementCountdown;
 	}
 }
 
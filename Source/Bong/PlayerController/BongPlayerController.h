@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
+#include "Bong/HUD/BongHUDViewModel.h"
 #include "BongPlayerController.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(BongPC, Log, All);
@@ -13,6 +14,7 @@ class ABongGameMode;
 class ABongPlayerState;
 class ABongCharacter;
 class UCharacterOverlay;
+class UAnnouncement;
 
 UCLASS()
 class BONG_API ABongPlayerController : public APlayerController
@@ -73,6 +75,7 @@ protected:
 	virtual void BeginPlay() override;
 	void SetHUDTime();
 	void PollInit();
+	void FlushHUDViewModel();
 
 	/*
 	 * Sync time between client and server
@@ -122,16 +125,11 @@ private:
 	UFUNCTION()
 	void OnRep_MatchState();
 	
+	// 上一次刷新过的控件，变化时说明控件被（重新）创建
 	UPROPERTY()
 	UCharacterOverlay* ToolCharacterOverlay;
+	UPROPERTY()
+	UAnnouncement* ToolAnnouncement;
 
-	bool bInitializeHealth, bInitializeScore, bInitializeDefeats;
-	float HUDHealth, HUDMaxHealth, HUDScore; // Cached HUD Values used for init
-	int32 HUDDefeats;
-
-
-
-	
-
-	bool temp0 = true;
+	FBongHUDViewModel HUDViewModel;
 };
@@ -3,7 +3,7 @@
 
 #include "Casing.h"
 
-#include "Kismet/GameplayStatics.h"
+#include "Bong/Weapon/ImpactAudioSubsystem.h"
 #include "Sound/SoundCue.h"
 
 
@@ -47,7 +47,10 @@ void ACasing::OnHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrim
 {
 	if(ShellSound)
 	{
-		UGameplayStatics::PlaySoundAtLocation(this, ShellSound, GetActorLocation());
+		if(UImpactAudioSubsystem* ImpactAudio = GetWorld()->GetSubsystem<UImpactAudioSubsystem>())
+		{
+			ImpactAudio->PlaySound(ShellSound, GetActorLocation(), EImpactAudioCategory::Casing);
+		}
 	}
 
 	// disable hit event so that the sound won't play multiple times
@@ -4,6 +4,8 @@
 #include "HitScanWeapon.h"
 
 #include "Bong/Character/BongCharacter.h"
+#include "Bong/Weapon/ImpactFXSubsystem.h"
+#include "Bong/Weapon/ImpactAudioSubsystem.h"
 #include "Engine/SkeletalMeshSocket.h"
 #include "Kismet/GameplayStatics.h"
 #include "Particles/ParticleSystemComponent.h"
@@ -18,6 +20,18 @@ AHitScanWeapon::AHitScanWeapon(const FObjectInitializer& ObjectInitializer)
 {
 }
 
+void AHitScanWeapon::GetAssetBundlePaths(FName Bundle, TArray<FSoftObjectPath>& OutPaths) const
+{
+	Super::GetAssetBundlePaths(Bundle, OutPaths);
+
+	if(Bundle == WeaponAssetBundles::Equipped)
+	{
+		OutPaths.Add(HitSound.ToSoftObjectPath());
+		OutPaths.Add(ImpactParticle.ToSoftObjectPath());
+		OutPaths.Add(BeamParticle.ToSoftObjectPath());
+	}
+}
+
 // 在所有机器执行
 void AHitScanWeapon::Fire(const FVector& HitTarget)
 {
@@ -69,24 +83,36 @@ void AHitScanWeapon::Fire(const FVector& HitTarget)
 					);
 			}
 		}
-		if(ImpactParticle)
+		SpawnImpactEffect(FireHitResult);
+		if(USoundCue* Sound = GetCosmeticAsset(HitSound))
 		{
-			UGameplayStatics::SpawnEmitterAtLocation(
-				this,
-				ImpactParticle,
-				FireHitResult.ImpactPoint,
-				FireHitResult.ImpactNormal.Rotation() /* 服务于粒子的方向性 */
-				);
+			if(UImpactAudioSubsystem* ImpactAudio = GetWorld()->GetSubsystem<UImpactAudioSubsystem>())
+			{
+				ImpactAudio->PlaySound(Sound, FireHitResult.ImpactPoint, EImpactAudioCategory::BulletImpact);
+			}
 		}
-		if(HitSound)
+
+	}
+}
+
+void AHitScanWeapon::SpawnImpactEffect(const FHitResult& HitResult)
+{
+	if(ImpactDataChannel)
+	{
+		// 专用服务器上没有这个子系统
+		if(UImpactFXSubsystem* ImpactFX = GetWorld()->GetSubsystem<UImpactFXSubsystem>())
 		{
-			UGameplayStatics::SpawnSoundAtLocation(
-				this,
-				HitSound,
-				FireHitResult.ImpactPoint
-				);
+			ImpactFX->AddImpact(ImpactDataChannel, HitResult.ImpactPoint, HitResult.ImpactNormal);
 		}
-
+	}
+	else if(UParticleSystem* Particle = GetCosmeticAsset(ImpactParticle))
+	{
+		UGameplayStatics::SpawnEmitterAtLocation(
+			this,
+			Particle,
+			HitResult.ImpactPoint,
+			HitResult.ImpactNormal.Rotation() /* 服务于粒子的方向性 */
+			);
 	}
 }
 
@@ -132,11 +158,18 @@ void AHitScanWeapon::WeaponTraceHit(const FVector& TraceStart, const FVector& Hi
 		{
 			BeamEnd = OutHitResult.ImpactPoint;
 		}
-		if(BeamParticle)
+		if(BeamDataChannel)
+		{
+			if(UImpactFXSubsystem* ImpactFX = World->GetSubsystem<UImpactFXSubsystem>())
+			{
+				ImpactFX->AddBeam(BeamDataChannel, TraceStart, BeamEnd);
+			}
+		}
+		else if(UParticleSystem* Particle = GetCosmeticAsset(BeamParticle))
 		{
 			UParticleSystemComponent* BeamComp = UGameplayStatics::SpawnEmitterAtLocation(
 				this,
-				BeamParticle,
+				Particle,
 				TraceStart,
 				FRotator::ZeroRotator,
 				true
@@ -8,6 +8,7 @@
 
 
 class UParticleSystem;
+class UNiagaraDataChannelAsset;
 
 UCLASS()
 class BONG_API AHitScanWeapon : public AWeapon
@@ -20,25 +21,35 @@ public:
 	virtual void Fire(const FVector& HitTarget) override;
 
 protected:
+	virtual void GetAssetBundlePaths(FName Bundle, TArray<FSoftObjectPath>& OutPaths) const override;
+
 	FVector TraceEndWithScatter(const FVector& TraceStart, const FVector& HitTarget);
 	void WeaponTraceHit(const FVector& TraceStart, const FVector& HitTarget,  FHitResult& OutHitResult);
+	// 设置了 ImpactDataChannel 时写入 UImpactFXSubsystem，否则退回 ImpactParticle
+	void SpawnImpactEffect(const FHitResult& HitResult);
 
 	UPROPERTY(EditAnywhere)
 	float Damage = 20.f;
 	// 这里不需要，放 开火动画里就行
 	// UParticleSystem* MuzzleFlash;
 	// USoundCue* FireSound;
-	UPROPERTY(EditDefaultsOnly)
-	USoundCue* HitSound;
+	UPROPERTY(EditDefaultsOnly, meta = (AssetBundles = "Equipped"))
+	TSoftObjectPtr<USoundCue> HitSound;
 
-	UPROPERTY(EditDefaultsOnly)
-	UParticleSystem* ImpactParticle;
+	UPROPERTY(EditDefaultsOnly, meta = (AssetBundles = "Equipped"))
+	TSoftObjectPtr<UParticleSystem> ImpactParticle;
+	// 命中特效的 Data Channel，由常驻的 Niagara System 统一绘制
+	UPROPERTY(EditDefaultsOnly, Category = "Effects")
+	TObjectPtr<UNiagaraDataChannelAsset> ImpactDataChannel;
 	
 private:
 	
 	
-	UPROPERTY(EditDefaultsOnly)
-	UParticleSystem* BeamParticle;
+	UPROPERTY(EditDefaultsOnly, meta = (AssetBundles = "Equipped"))
+	TSoftObjectPtr<UParticleSystem> BeamParticle;
+	// 弹道烟雾的 Data Channel，设置后不再每发生成 BeamParticle 组件
+	UPROPERTY(EditDefaultsOnly, Category = "Effects")
+	TObjectPtr<UNiagaraDataChannelAsset> BeamDataChannel;
 
 	/*
 	 * Trace end with scatter
@@ -4,6 +4,7 @@
 #include "Engine/SkeletalMeshSocket.h"
 #include "Bong/Character/BongCharacter.h"
 #include "Bong/PlayerController/BongPlayerController.h"
+#include "Bong/Weapon/ImpactAudioSubsystem.h"
 //#include "Bong/BlasterComponents/LagCompensationComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "particles/ParticleSystemComponent.h"
@@ -50,23 +51,19 @@ void AShotgun::Fire(const FVector& HitTarget)
 				else   HitMapping.Emplace(BongCharacter, 1);
 			}
 			/// 需要再次实现未从 HitScanWeapon继承的功能：伤害施加，击中特效音效
-			if(ImpactParticle)
+			SpawnImpactEffect(FireHitResult);
+			// 同一次开火的弹丸打在附近时会合并成一次播放
+			if(USoundCue* Sound = GetCosmeticAsset(HitSound))
 			{
-				UGameplayStatics::SpawnEmitterAtLocation(
-					this,
-					ImpactParticle,
-					FireHitResult.ImpactPoint,
-					FireHitResult.ImpactNormal.Rotation(),
-					true);
-			}
-			if(HitSound)
-			{
-				UGameplayStatics::PlaySoundAtLocation(
-					this,
-					HitSound,
-					FireHitResult.ImpactPoint,
-					0.5f,
-					FMath::FRandRange(-0.5f, 0.5f));
+				if(UImpactAudioSubsystem* ImpactAudio = GetWorld()->GetSubsystem<UImpactAudioSubsystem>())
+				{
+					ImpactAudio->PlaySound(
+						Sound,
+						FireHitResult.ImpactPoint,
+						EImpactAudioCategory::BulletImpact,
+						0.5f,
+						FMath::FRandRange(-0.5f, 0.5f));
+				}
 			}
 		}
 		
@@ -0,0 +1,221 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ImpactAudioSubsystem.h"
+#include "Components/AudioComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+#include "Sound/SoundBase.h"
+
+
+namespace ImpactAudio
+{
+	struct FCategorySettings
+	{
+		// 同时发声上限
+		int32 MaxVoices;
+		// 一帧内这个范围里的同一声音合并为一次
+		float CoalesceRadius;
+		// 超过这个距离不播放
+		float MaxDistance;
+	};
+
+	// 顺序和 EImpactAudioCategory 一致
+	constexpr FCategorySettings CategorySettings[] =
+	{
+		{ 12, 150.f, 6000.f },	// BulletImpact
+		{ 4, 400.f, 15000.f },	// Explosion
+		{ 6, 100.f, 2000.f },	// Casing
+		{ 4, 0.f, 15000.f },	// Elim
+	};
+	static_assert(UE_ARRAY_COUNT(CategorySettings) == (int32)EImpactAudioCategory::MAX, "CategorySettings 和 EImpactAudioCategory 不一致");
+
+	// 合并后的音量上限，避免一把霰弹的声音比爆炸还大
+	constexpr float MaxCoalescedVolume = 1.5f;
+
+	const FCategorySettings& GetSettings(EImpactAudioCategory Category)
+	{
+		return CategorySettings[(int32)Category];
+	}
+
+	int32 GetMaxPoolSize()
+	{
+		int32 PoolSize = 0;
+		for(const FCategorySettings& Settings : CategorySettings)
+		{
+			PoolSize += Settings.MaxVoices;
+		}
+		return PoolSize;
+	}
+}
+
+
+bool UImpactAudioSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if(!Super::ShouldCreateSubsystem(Outer)) return false;
+
+	// 专用服务器没有声音
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World == nullptr || World->GetNetMode() != NM_DedicatedServer;
+}
+
+void UImpactAudioSubsystem::Deinitialize()
+{
+	for(UAudioComponent* AudioComp : Pool)
+	{
+		if(AudioComp)
+		{
+			AudioComp->DestroyComponent();
+		}
+	}
+	Pool.Empty();
+	Voices.Empty();
+	PendingSounds.Empty();
+
+	Super::Deinitialize();
+}
+
+void UImpactAudioSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if(PendingSounds.Num() == 0) return;
+
+	// 近的先播，发声数满了之后远的自然被剔除
+	PendingSounds.Sort([](const FPendingSound& A, const FPendingSound& B) { return A.DistanceSquared < B.DistanceSquared; });
+	for(const FPendingSound& Pending : PendingSounds)
+	{
+		PlayPendingSound(Pending);
+	}
+	PendingSounds.Reset();
+}
+
+TStatId UImpactAudioSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UImpactAudioSubsystem, STATGROUP_Tickables);
+}
+
+void UImpactAudioSubsystem::PlaySound(USoundBase* Sound, const FVector& Location, EImpactAudioCategory Category, float VolumeMultiplier, float PitchMultiplier)
+{
+	if(Sound == nullptr) return;
+
+	const ImpactAudio::FCategorySettings& Settings = ImpactAudio::GetSettings(Category);
+
+	FVector Listener;
+	const float DistanceSquared = GetListenerLocation(Listener) ? FVector::DistSquared(Listener, Location) : 0.f;
+	if(DistanceSquared > FMath::Square(Settings.MaxDistance)) return;
+
+	// 同一帧附近位置的同一声音只播一次，音量略微叠加
+	for(FPendingSound& Pending : PendingSounds)
+	{
+		if(Pending.Category == Category && Pending.Sound == Sound &&
+			FVector::DistSquared(Pending.Location, Location) <= FMath::Square(Settings.CoalesceRadius))
+		{
+			Pending.VolumeMultiplier = FMath::Min(Pending.VolumeMultiplier + VolumeMultiplier * 0.25f, ImpactAudio::MaxCoalescedVolume);
+			return;
+		}
+	}
+
+	PendingSounds.Add({Sound, Location, Category, VolumeMultiplier, PitchMultiplier, DistanceSquared});
+}
+
+void UImpactAudioSubsystem::PlayPendingSound(const FPendingSound& Pending)
+{
+	USoundBase* Sound = Pending.Sound.Get();
+	if(Sound == nullptr) return;
+
+	const int32 VoiceIndex = AcquireVoice(Pending);
+	if(VoiceIndex == INDEX_NONE) return;
+
+	UAudioComponent* AudioComp = Pool[VoiceIndex];
+	if(AudioComp == nullptr)
+	{
+		// 不自动销毁，播完留在池里
+		AudioComp = UGameplayStatics::SpawnSoundAtLocation(this, Sound, Pending.Location, FRotator::ZeroRotator,
+			Pending.VolumeMultiplier, Pending.PitchMultiplier, 0.f, nullptr, nullptr, false);
+		Pool[VoiceIndex] = AudioComp;
+		if(AudioComp == nullptr) return;
+	}
+	else
+	{
+		AudioComp->SetSound(Sound);
+		AudioComp->SetWorldLocation(Pending.Location);
+		AudioComp->SetVolumeMultiplier(Pending.VolumeMultiplier);
+		AudioComp->SetPitchMultiplier(Pending.PitchMultiplier);
+		AudioComp->Play();
+	}
+
+	Voices[VoiceIndex].Category = Pending.Category;
+	Voices[VoiceIndex].DistanceSquared = Pending.DistanceSquared;
+}
+
+int32 UImpactAudioSubsystem::AcquireVoice(const FPendingSound& Pending)
+{
+	int32 ActiveVoices = 0;
+	int32 FarthestVoice = INDEX_NONE;
+	int32 FreeVoice = INDEX_NONE;
+
+	for(int32 Index = 0; Index < Pool.Num(); ++Index)
+	{
+		UAudioComponent* AudioComp = Pool[Index];
+		if(AudioComp == nullptr || !AudioComp->IsPlaying())
+		{
+			if(FreeVoice == INDEX_NONE)
+			{
+				FreeVoice = Index;
+			}
+			continue;
+		}
+		if(Voices[Index].Category == Pending.Category)
+		{
+			++ActiveVoices;
+			if(FarthestVoice == INDEX_NONE || Voices[Index].DistanceSquared > Voices[FarthestVoice].DistanceSquared)
+			{
+				FarthestVoice = Index;
+			}
+		}
+	}
+
+	// 这一类已经满了：比正在播放的最远的一个更近才抢占
+	if(ActiveVoices >= ImpactAudio::GetSettings(Pending.Category).MaxVoices)
+	{
+		if(FarthestVoice != INDEX_NONE && Voices[FarthestVoice].DistanceSquared > Pending.DistanceSquared)
+		{
+			Pool[FarthestVoice]->Stop();
+			return FarthestVoice;
+		}
+		return INDEX_NONE;
+	}
+
+	if(FreeVoice != INDEX_NONE)
+	{
+		return FreeVoice;
+	}
+	if(Pool.Num() < ImpactAudio::GetMaxPoolSize())
+	{
+		Voices.AddDefaulted();
+		return Pool.Add(nullptr);
+	}
+	return INDEX_NONE;
+}
+
+bool UImpactAudioSubsystem::GetListenerLocation(FVector& OutLocation)
+{
+	// 同一帧内的多次播放共用一次听者查询
+	if(ListenerLocationFrame != GFrameCounter)
+	{
+		ListenerLocationFrame = GFrameCounter;
+		bHasListenerLocation = false;
+
+		if(const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController())
+		{
+			FVector FrontDir;
+			FVector RightDir;
+			PlayerController->GetAudioListenerPosition(ListenerLocation, FrontDir, RightDir);
+			bHasListenerLocation = true;
+		}
+	}
+
+	OutLocation = ListenerLocation;
+	return bHasListenerLocation;
+}
@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ImpactAudioSubsystem.generated.h"
+
+class USoundBase;
+class UAudioComponent;
+
+// 每类声音有自己的同时发声上限、合并半径和最远距离
+enum class EImpactAudioCategory : uint8
+{
+	BulletImpact,
+	Explosion,
+	Casing,
+	Elim,
+
+	MAX
+};
+
+/**
+ * 命中类一次性音效的统一出口，代替每次命中 SpawnSoundAtLocation/PlaySoundAtLocation
+ * 一帧内同一声音在附近位置的多次播放合并为一次（霰弹枪的多颗弹丸），每类声音限制同时发声数，
+ * 超出时按到听者的距离保留近的，AudioComponent 从池里复用，不再每次生成新的组件
+ */
+UCLASS()
+class BONG_API UImpactAudioSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 这一帧结束时统一播放
+	void PlaySound(USoundBase* Sound, const FVector& Location, EImpactAudioCategory Category, float VolumeMultiplier = 1.f, float PitchMultiplier = 1.f);
+
+private:
+	struct FPendingSound
+	{
+		TWeakObjectPtr<USoundBase> Sound;
+		FVector Location;
+		EImpactAudioCategory Category;
+		float VolumeMultiplier;
+		float PitchMultiplier;
+		float DistanceSquared;
+	};
+
+	// Pool 里每个组件当前播放的声音属于哪类、离听者多远
+	struct FVoiceInfo
+	{
+		EImpactAudioCategory Category = EImpactAudioCategory::MAX;
+		float DistanceSquared = 0.f;
+	};
+
+	void PlayPendingSound(const FPendingSound& Pending);
+	// 找一个可以用来播放的组件，找不到返回 INDEX_NONE
+	int32 AcquireVoice(const FPendingSound& Pending);
+	bool GetListenerLocation(FVector& OutLocation);
+
+	TArray<FPendingSound> PendingSounds;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAudioComponent>> Pool;
+	TArray<FVoiceInfo> Voices;
+
+	// 本帧的听者位置，第一次 PlaySound 时取一次
+	FVector ListenerLocation = FVector::ZeroVector;
+	bool bHasListenerLocation = false;
+	uint64 ListenerLocationFrame = 0;
+};
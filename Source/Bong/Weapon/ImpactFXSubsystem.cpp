@@ -0,0 +1,147 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ImpactFXSubsystem.h"
+#include "NiagaraDataChannel.h"
+#include "NiagaraDataChannelAccessor.h"
+#include "Camera/PlayerCameraManager.h"
+#include "GameFramework/PlayerController.h"
+
+
+namespace ImpactFX
+{
+	// 超过这个距离的命中看不清，直接丢掉
+	constexpr float CullDistance = 8000.f;
+	// 每个 Data Channel 每帧最多写入的数量，超出时保留离视点近的
+	constexpr int32 MaxImpactsPerFrame = 64;
+	constexpr int32 MaxBeamsPerFrame = 32;
+}
+
+
+bool UImpactFXSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if(!Super::ShouldCreateSubsystem(Outer)) return false;
+
+	// 专用服务器不需要特效
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World == nullptr || World->GetNetMode() != NM_DedicatedServer;
+}
+
+void UImpactFXSubsystem::Deinitialize()
+{
+	PendingBatches.Empty();
+
+	Super::Deinitialize();
+}
+
+void UImpactFXSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if(PendingBatches.Num() == 0) return;
+
+	for(TPair<FFXBatchKey, TArray<FFXEvent>>& Pair : PendingBatches)
+	{
+		const UNiagaraDataChannelAsset* Channel = Pair.Key.Key.Get();
+		if(Channel && Pair.Value.Num() > 0)
+		{
+			WriteBatch(Channel, Pair.Key.Value, Pair.Value);
+		}
+	}
+	PendingBatches.Reset();
+}
+
+TStatId UImpactFXSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UImpactFXSubsystem, STATGROUP_Tickables);
+}
+
+void UImpactFXSubsystem::AddImpact(const UNiagaraDataChannelAsset* Channel, const FVector& Location, const FVector& Normal)
+{
+	if(Channel == nullptr) return;
+
+	FVector View;
+	const float DistanceSquared = GetViewLocation(View) ? FVector::DistSquared(View, Location) : 0.f;
+	if(DistanceSquared > FMath::Square(ImpactFX::CullDistance)) return;
+
+	AddEvent(Channel, false, Location, Normal, DistanceSquared);
+}
+
+void UImpactFXSubsystem::AddBeam(const UNiagaraDataChannelAsset* Channel, const FVector& Start, const FVector& End)
+{
+	if(Channel == nullptr) return;
+
+	// 弹道按线段上离视点最近的点剔除，远处射过来的子弹经过身边时也能看到
+	FVector View;
+	const float DistanceSquared = GetViewLocation(View) ? FMath::PointDistToSegmentSquared(View, Start, End) : 0.f;
+	if(DistanceSquared > FMath::Square(ImpactFX::CullDistance)) return;
+
+	AddEvent(Channel, true, Start, End, DistanceSquared);
+}
+
+void UImpactFXSubsystem::AddEvent(const UNiagaraDataChannelAsset* Channel, bool bBeam, const FVector& Position, const FVector& Vector, float DistanceSquared)
+{
+	PendingBatches.FindOrAdd(FFXBatchKey(Channel, bBeam)).Add({Position, Vector, DistanceSquared});
+}
+
+void UImpactFXSubsystem::WriteBatch(const UNiagaraDataChannelAsset* Channel, bool bBeam, TArray<FFXEvent>& Events)
+{
+	const int32 MaxPerFrame = bBeam ? ImpactFX::MaxBeamsPerFrame : ImpactFX::MaxImpactsPerFrame;
+	if(Events.Num() > MaxPerFrame)
+	{
+		Events.Sort([](const FFXEvent& A, const FFXEvent& B) { return A.DistanceSquared < B.DistanceSquared; });
+		Events.SetNum(MaxPerFrame, EAllowShrinking::No);
+	}
+
+	FNiagaraDataChannelSearchParameters SearchParams;
+	SearchParams.Location = bHasViewLocation ? ViewLocation : Events[0].Position;
+
+	UNiagaraDataChannelWriter* Writer = UNiagaraDataChannelLibrary::WriteToNiagaraDataChannel(
+		this,
+		Channel,
+		SearchParams,
+		Events.Num(),
+		false /* 游戏逻辑不读 */,
+		true,
+		true,
+		TEXT("UImpactFXSubsystem"));
+	if(Writer == nullptr) return;
+
+	static const FName PositionName(TEXT("Position"));
+	static const FName NormalName(TEXT("Normal"));
+	static const FName BeamEndName(TEXT("BeamEnd"));
+
+	for(int32 Index = 0; Index < Events.Num(); ++Index)
+	{
+		const FFXEvent& Event = Events[Index];
+		Writer->WritePosition(PositionName, Index, Event.Position);
+		if(bBeam)
+		{
+			Writer->WritePosition(BeamEndName, Index, Event.Vector);
+		}
+		else
+		{
+			Writer->WriteVector(NormalName, Index, Event.Vector);
+		}
+	}
+}
+
+bool UImpactFXSubsystem::GetViewLocation(FVector& OutLocation)
+{
+	// 同一帧内的多次命中共用一次视点查询
+	if(ViewLocationFrame != GFrameCounter)
+	{
+		ViewLocationFrame = GFrameCounter;
+		bHasViewLocation = false;
+
+		const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+		if(PlayerController && PlayerController->PlayerCameraManager)
+		{
+			ViewLocation = PlayerController->PlayerCameraManager->GetCameraLocation();
+			bHasViewLocation = true;
+		}
+	}
+
+	OutLocation = ViewLocation;
+	return bHasViewLocation;
+}
@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ImpactFXSubsystem.generated.h"
+
+class UNiagaraDataChannelAsset;
+
+/**
+ * 命中、弹道、淘汰特效的批量提交，代替每次命中 SpawnEmitterAtLocation 生成一个组件
+ * 各端本地收集这一帧的事件，距离剔除并按数量上限截断后，每个 Niagara Data Channel 只写入一次
+ * 真正的绘制由读取 Data Channel 的少数常驻 Niagara System 完成（在 Data Channel 资源里配置），每发子弹不再创建组件
+ *
+ * Data Channel 需要的变量：
+ *   命中/淘汰：Position(Position)、Normal(Vector)
+ *   弹道：Position(Position，起点)、BeamEnd(Position)
+ *
+ * 各处的 Data Channel 属性默认为空，项目里还没有对应的 Data Channel 和 Niagara System 资源，
+ * 为空时调用方仍走原来的 Cascade 生成路径；资源做好并在蓝图里指定后才会切到这里
+ */
+UCLASS()
+class BONG_API UImpactFXSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void AddImpact(const UNiagaraDataChannelAsset* Channel, const FVector& Location, const FVector& Normal);
+	void AddBeam(const UNiagaraDataChannelAsset* Channel, const FVector& Start, const FVector& End);
+
+private:
+	struct FFXEvent
+	{
+		FVector Position;
+		// 命中时是法线，弹道时是终点
+		FVector Vector;
+		float DistanceSquared;
+	};
+
+	// 同一个 Data Channel 可能同时收到命中和弹道，两种写入布局不同，所以按 (Channel, 是否弹道) 分组
+	using FFXBatchKey = TPair<TWeakObjectPtr<const UNiagaraDataChannelAsset>, bool>;
+
+	void AddEvent(const UNiagaraDataChannelAsset* Channel, bool bBeam, const FVector& Position, const FVector& Vector, float DistanceSquared);
+	void WriteBatch(const UNiagaraDataChannelAsset* Channel, bool bBeam, TArray<FFXEvent>& Events);
+	bool GetViewLocation(FVector& OutLocation);
+
+	// 按 Data Channel 和类型分组，每帧清空
+	TMap<FFXBatchKey, TArray<FFXEvent>> PendingBatches;
+
+	// 本帧的视点，第一次 Add 时取一次
+	FVector ViewLocation = FVector::ZeroVector;
+	bool bHasViewLocation = false;
+	uint64 ViewLocationFrame = 0;
+};
@@ -9,6 +9,9 @@
 #include "Particles/ParticleSystemComponent.h"
 #include "Sound/SoundCue.h"
 #include "Bong/Character/BongCharacter.h"
+#include "Bong/Weapon/ImpactFXSubsystem.h"
+#include "Bong/Weapon/ImpactAudioSubsystem.h"
+#include "ProjectileSimulationSubsystem.h"
 #include "Bong/Bong.h"
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraComponent.h"
@@ -50,7 +53,7 @@ void AProjectile::BeginPlay()
 	}
 	// 只在服务端绑定
 	// 构造函数绑定的话，BoxComp还没实例化
-	if(HasAuthority())
+	if(HasAuthority() && !bUseProjectileSimulation)
 	{
 		BoxComp->OnComponentHit.AddDynamic(this, &AProjectile::OnHit);
 
@@ -75,6 +78,49 @@ void AProjectile::Finished_DestroyTimer()
 	Destroy(); // Destroyed() 有爆炸和音效，会被执行
 }
 
+void AProjectile::StartProjectileSimulation(UProjectileMovementComponent* MovementComp)
+{
+	if(UProjectileSimulationSubsystem* ProjectileSimulation = GetWorld()->GetSubsystem<UProjectileSimulationSubsystem>())
+	{
+		ProjectileSimulation->RegisterProjectile(this, MovementComp);
+	}
+}
+
+void AProjectile::HandleSimulatedHit(const FHitResult& Hit, const FVector& ImpactVelocity)
+{
+	if(HasAuthority())
+	{
+		OnHit(BoxComp, Hit.GetActor(), Hit.GetComponent(), FVector::ZeroVector, Hit);
+	}
+}
+
+void AProjectile::SpawnImpactEffect()
+{
+	if(ImpactDataChannel)
+	{
+		if(UImpactFXSubsystem* ImpactFX = GetWorld()->GetSubsystem<UImpactFXSubsystem>())
+		{
+			// 弹丸朝向的反方向当作爆炸的法线
+			ImpactFX->AddImpact(ImpactDataChannel, GetActorLocation(), -GetActorForwardVector());
+		}
+	}
+	else if(ImpactParticles)
+	{
+		UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), ImpactParticles, GetActorTransform() );
+	}
+}
+
+void AProjectile::PlayImpactSound()
+{
+	if(ImpactSound)
+	{
+		if(UImpactAudioSubsystem* ImpactAudio = GetWorld()->GetSubsystem<UImpactAudioSubsystem>())
+		{
+			ImpactAudio->PlaySound(ImpactSound, GetActorLocation(), EImpactAudioCategory::Explosion);
+		}
+	}
+}
+
 void AProjectile::SpawnTrailSystem()
 {
 	if(TrailNiagaraSystem)
@@ -150,14 +196,8 @@ void AProjectile::Destroyed()
 	// if(IsPendingKillPending() == true && IsValid(this))
 	// {
 		// 如果蓝图已配置
-        if(ImpactParticles)
-        {
-            UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), ImpactParticles, GetActorTransform() );
-        }
-        if(ImpactSound)
-        {
-            UGameplayStatics::PlaySoundAtLocation(this, ImpactSound, GetActorLocation() );
-        }
+        SpawnImpactEffect();
+        PlayImpactSound();
 	// }
 	// else
 	// {
@@ -14,6 +14,7 @@ class UParticleSystemComponent;
 class USoundCue;
 class UNiagaraSystem;
 class UNiagaraComponent;
+class UNiagaraDataChannelAsset;
 
 
 UCLASS()
@@ -27,6 +28,9 @@ public:
 	virtual void Tick(float DeltaTime) override;
 	/** Called when this actor is explicitly being destroyed during gameplay or in the editor, not called during level streaming or gameplay ending */
 	virtual void Destroyed() override;
+
+	// UProjectileSimulationSubsystem 的 Sweep 命中时调用，默认和 BoxComp 命中回调一样只在服务端处理
+	virtual void HandleSimulatedHit(const FHitResult& Hit, const FVector& ImpactVelocity);
 	
 protected:
 	virtual void BeginPlay() override;
@@ -34,6 +38,12 @@ protected:
 	void Finished_DestroyTimer();
 	// Niagara特效烟雾轨迹
 	void SpawnTrailSystem();
+	// 交给 UProjectileSimulationSubsystem 移动，不再由移动组件每帧分步 Sweep
+	void StartProjectileSimulation(UProjectileMovementComponent* MovementComp);
+	// 爆炸特效：设置了 ImpactDataChannel 时写入 UImpactFXSubsystem，否则退回 ImpactParticles
+	void SpawnImpactEffect();
+	// 爆炸音效交给 UImpactAudioSubsystem
+	void PlayImpactSound();
 	void ExplodeDamage();
 	
 	UFUNCTION()
@@ -41,6 +51,8 @@ protected:
 	// 弹丸命中相关
  	UPROPERTY(EditAnywhere)
  	TObjectPtr<UParticleSystem> ImpactParticles;
+	UPROPERTY(EditAnywhere)
+	TObjectPtr<UNiagaraDataChannelAsset> ImpactDataChannel;
  	UPROPERTY(EditAnywhere)
  	TObjectPtr<USoundCue> ImpactSound;
 
@@ -61,6 +73,10 @@ protected:
 
 	UPROPERTY(VisibleAnywhere)
 	UStaticMeshComponent* ProjectileMesh;
+
+	// 火箭弹和手雷开启，由 UProjectileSimulationSubsystem 按固定步长移动，BoxComp 不再绑定命中回调
+	UPROPERTY(EditDefaultsOnly)
+	bool bUseProjectileSimulation = false;
 	
 	UPROPERTY(EditAnywhere)
 	float DamageInnerRadius = 200.f;
@@ -81,6 +97,7 @@ private:
 	float DestroyTime = 3.f;
 
 public:
+	FORCEINLINE UBoxComponent* GetBoxComp() const { return BoxComp; }
 	
 };
 
@@ -19,6 +19,7 @@ AProjectileGrenade::AProjectileGrenade(const FObjectInitializer& ObjectInitializ
 	ProjectileMovementComp->bRotationFollowsVelocity = true; // 考虑到重力衰减
 	ProjectileMovementComp->SetIsReplicated(true);
 	ProjectileMovementComp->bShouldBounce = true;
+	bUseProjectileSimulation = true;
 }
 
 void AProjectileGrenade::Destroyed()
@@ -35,7 +36,19 @@ void AProjectileGrenade::BeginPlay()
 	SpawnTrailSystem();
 	Start_DestroyTimer();
 
-	ProjectileMovementComp->OnProjectileBounce.AddDynamic(this, &AProjectileGrenade::OnBounce);
+	if(bUseProjectileSimulation)
+	{
+		StartProjectileSimulation(ProjectileMovementComp);
+	}
+	else
+	{
+		ProjectileMovementComp->OnProjectileBounce.AddDynamic(this, &AProjectileGrenade::OnBounce);
+	}
+}
+
+void AProjectileGrenade::HandleSimulatedHit(const FHitResult& Hit, const FVector& ImpactVelocity)
+{
+	OnBounce(Hit, ImpactVelocity);
 }
 
 void AProjectileGrenade::OnBounce(const FHitResult& ImpactResult, const FVector& ImpactVelocity)
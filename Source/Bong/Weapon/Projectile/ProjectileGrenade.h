@@ -16,6 +16,8 @@ public:
 	AProjectileGrenade(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 	
 	virtual void Destroyed() override;
+	// 模拟时的碰撞都是弹跳
+	virtual void HandleSimulatedHit(const FHitResult& Hit, const FVector& ImpactVelocity) override;
 
 protected:
 	virtual void BeginPlay() override;
@@ -25,6 +25,7 @@ AProjectileRocket::AProjectileRocket(const FObjectInitializer& ObjectInitializer
 	RocketMovementComp = CreateDefaultSubobject<URocketMovementComponent>(TEXT("RocketMovementComp"));
 	RocketMovementComp->bRotationFollowsVelocity = true; // 考虑重力下落
 	RocketMovementComp->SetIsReplicated(true); // 保险组件复制
+	bUseProjectileSimulation = true;
 	
 	/// 类似Timeline组件，不需要实例化
 	// NiagaraSystemComp = CreateDefaultSubobject<UNiagaraComponent>(TEXT("NiagaraComp"));
@@ -37,7 +38,11 @@ void AProjectileRocket::BeginPlay()
 
 	/// 弹丸都在服务端生成， 命中回调 父类是在服务端，火箭弹子类是在所有客户端，导致在所有机器上都有
 	// 构造函数绑定的话，BoxComp还没实例化
-	if( !HasAuthority())
+	if(bUseProjectileSimulation)
+	{
+		StartProjectileSimulation(RocketMovementComp);
+	}
+	else if( !HasAuthority())
 	{
 		BoxComp->OnComponentHit.AddDynamic(this, &AProjectileRocket::OnHit);
 	}
@@ -66,6 +71,11 @@ void AProjectileRocket::BeginPlay()
 	}
 }
 
+void AProjectileRocket::HandleSimulatedHit(const FHitResult& Hit, const FVector& ImpactVelocity)
+{
+	OnHit(BoxComp, Hit.GetActor(), Hit.GetComponent(), FVector::ZeroVector, Hit);
+}
+
 void AProjectileRocket::OnHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, FVector NormalImpulse, const FHitResult& Hit)
 {
 	if(OtherActor == GetOwner())
@@ -78,14 +88,8 @@ void AProjectileRocket::OnHit(UPrimitiveComponent* HitComponent, AActor* OtherAc
 	Start_DestroyTimer();
 	
 	// 播放爆炸特效和音效, 如果蓝图已配置
-	if(ImpactParticles)
-	{
-		UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), ImpactParticles, GetActorTransform() );
-	}
-	if(ImpactSound)
-	{
-		UGameplayStatics::PlaySoundAtLocation(this, ImpactSound, GetActorLocation() );
-	}
+	SpawnImpactEffect();
+	PlayImpactSound();
 	
 	// 不再生成更多粒子，且 隐藏子弹网格体
 	if(ProjectileMesh)
@@ -19,6 +19,8 @@ public:
 	
 	// 重写了，不作为，就可以抵消父类该函数的影响，即覆盖
 	virtual void Destroyed() override;
+	// 和原来 BoxComp 的命中回调一样，所有机器都处理
+	virtual void HandleSimulatedHit(const FHitResult& Hit, const FVector& ImpactVelocity) override;
 	
 protected:
 	virtual void BeginPlay() override;
@@ -0,0 +1,217 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "ProjectileSimulationSubsystem.h"
+#include "Projectile.h"
+#include "Components/BoxComponent.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+
+
+namespace ProjectileSimulation
+{
+	// 没有开启 Async Physics 时的积分步长
+	constexpr float FixedTimeStep = 1.f / 60.f;
+	// 卡顿时一帧最多积分的步数，超出的时间丢掉
+	constexpr int32 MaxStepsPerFrame = 8;
+}
+
+
+void UProjectileSimulationSubsystem::Deinitialize()
+{
+	Projectiles.Empty();
+
+	Super::Deinitialize();
+}
+
+void UProjectileSimulationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if(Projectiles.Num() == 0) return;
+
+	const UPhysicsSettings* PhysicsSettings = UPhysicsSettings::Get();
+	const float StepSize = PhysicsSettings->bTickPhysicsAsync ? PhysicsSettings->AsyncFixedTimeStepSize : ProjectileSimulation::FixedTimeStep;
+
+	// 命中回调里可能销毁弹丸或注册新的弹丸，先收集，遍历结束后再派发
+	TArray<FSimulatedHit> Hits;
+
+	for(int32 Index = Projectiles.Num() - 1; Index >= 0; --Index)
+	{
+		FSimulatedProjectile& Simulated = Projectiles[Index];
+		AProjectile* Projectile = Simulated.Projectile.Get();
+		if(Projectile == nullptr)
+		{
+			Projectiles.RemoveAtSwap(Index);
+			continue;
+		}
+
+		Simulated.TimeAccumulator = FMath::Min(Simulated.TimeAccumulator + DeltaTime, StepSize * ProjectileSimulation::MaxStepsPerFrame);
+
+		if(Simulated.bSweepPending)
+		{
+			FTraceDatum SweepData;
+			if(GetWorld()->QueryTraceData(Simulated.SweepHandle, SweepData))
+			{
+				if(!ConsumeSweepResult(Simulated, SweepData, Hits))
+				{
+					Projectiles.RemoveAtSwap(Index);
+					continue;
+				}
+			}
+			else if(GetWorld()->IsTraceHandleValid(Simulated.SweepHandle, false))
+			{
+				// 还没完成时保持不动，时间留到下次积分
+				continue;
+			}
+			else
+			{
+				// 结果已经过期（比如中间暂停过），从确认的位置重新发起
+				Simulated.bSweepPending = false;
+			}
+		}
+
+		if(!Simulated.bAtRest)
+		{
+			StartSweep(Simulated, StepSize);
+		}
+	}
+
+	for(const FSimulatedHit& SimulatedHit : Hits)
+	{
+		if(AProjectile* Projectile = SimulatedHit.Projectile.Get())
+		{
+			Projectile->HandleSimulatedHit(SimulatedHit.Hit, SimulatedHit.ImpactVelocity);
+		}
+	}
+}
+
+TStatId UProjectileSimulationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UProjectileSimulationSubsystem, STATGROUP_Tickables);
+}
+
+void UProjectileSimulationSubsystem::RegisterProjectile(AProjectile* Projectile, UProjectileMovementComponent* MovementComp)
+{
+	if(Projectile == nullptr || MovementComp == nullptr) return;
+
+	UnregisterProjectile(Projectile);
+
+	// InitializeComponent 里已经根据 InitialSpeed 和朝向算好了初速度
+	FSimulatedProjectile& Simulated = Projectiles.AddDefaulted_GetRef();
+	Simulated.Projectile = Projectile;
+	Simulated.Location = Projectile->GetActorLocation();
+	Simulated.Velocity = MovementComp->Velocity;
+	Simulated.GravityZ = MovementComp->GetGravityZ();
+	Simulated.MaxSpeed = MovementComp->GetMaxSpeed();
+	Simulated.bRotationFollowsVelocity = MovementComp->bRotationFollowsVelocity;
+	Simulated.bShouldBounce = MovementComp->bShouldBounce;
+	Simulated.Bounciness = MovementComp->Bounciness;
+	Simulated.Friction = MovementComp->Friction;
+	Simulated.BounceVelocityStopSimulatingThreshold = MovementComp->BounceVelocityStopSimulatingThreshold;
+
+	// 和 BoxComp 原来移动时的碰撞一致
+	const UBoxComponent* BoxComp = Projectile->GetBoxComp();
+	Simulated.Shape = BoxComp->GetCollisionShape();
+	Simulated.CollisionChannel = BoxComp->GetCollisionObjectType();
+	Simulated.ResponseParams = FCollisionResponseParams(BoxComp->GetCollisionResponseToChannels());
+	Simulated.QueryParams = FCollisionQueryParams(SCENE_QUERY_STAT(ProjectileSimulation), false, Projectile);
+	Simulated.QueryParams.AddIgnoredActor(Projectile->GetOwner());
+	Simulated.QueryParams.AddIgnoredActor(Projectile->GetInstigator());
+
+	MovementComp->SetComponentTickEnabled(false);
+}
+
+void UProjectileSimulationSubsystem::UnregisterProjectile(AProjectile* Projectile)
+{
+	Projectiles.RemoveAllSwap([Projectile](const FSimulatedProjectile& Simulated) { return Simulated.Projectile == Projectile; });
+}
+
+bool UProjectileSimulationSubsystem::ConsumeSweepResult(FSimulatedProjectile& Simulated, const FTraceDatum& SweepData, TArray<FSimulatedHit>& OutHits)
+{
+	Simulated.bSweepPending = false;
+
+	const FHitResult* Hit = SweepData.OutHits.FindByPredicate([](const FHitResult& HitResult) { return HitResult.bBlockingHit; });
+
+	if(Hit == nullptr)
+	{
+		Simulated.Location = Simulated.PendingLocation;
+		Simulated.Velocity = Simulated.PendingVelocity;
+	}
+	else
+	{
+		const FVector ImpactVelocity = FMath::Lerp(Simulated.Velocity, Simulated.PendingVelocity, Hit->Time);
+		Simulated.Location = Hit->Location;
+		Simulated.Velocity = ImpactVelocity;
+		OutHits.Add({Simulated.Projectile, *Hit, ImpactVelocity});
+
+		if(!Simulated.bShouldBounce)
+		{
+			// 火箭弹命中即停止
+			Simulated.Projectile->SetActorLocation(Simulated.Location);
+			return false;
+		}
+
+		// 和 UProjectileMovementComponent::ComputeBounceResult 一致：法线方向按 Bounciness 反弹，切线方向按 Friction 衰减
+		const float VDotNormal = Simulated.Velocity | Hit->Normal;
+		if(VDotNormal < 0.f)
+		{
+			const FVector ProjectedNormal = Hit->Normal * -VDotNormal;
+			Simulated.Velocity += ProjectedNormal;
+			Simulated.Velocity *= FMath::Clamp(1.f - Simulated.Friction, 0.f, 1.f);
+			Simulated.Velocity += ProjectedNormal * FMath::Max(Simulated.Bounciness, 0.f);
+		}
+		// 稍微离开表面，下一次 Sweep 不会从穿透状态开始
+		Simulated.Location += Hit->Normal * 0.1f;
+
+		if(Simulated.Velocity.SizeSquared() < FMath::Square(Simulated.BounceVelocityStopSimulatingThreshold))
+		{
+			Simulated.Velocity = FVector::ZeroVector;
+			Simulated.bAtRest = true;
+		}
+	}
+
+	AProjectile* Projectile = Simulated.Projectile.Get();
+	if(Simulated.bRotationFollowsVelocity && !Simulated.Velocity.IsNearlyZero())
+	{
+		Projectile->SetActorLocationAndRotation(Simulated.Location, Simulated.Velocity.Rotation());
+	}
+	else
+	{
+		Projectile->SetActorLocation(Simulated.Location);
+	}
+	return true;
+}
+
+void UProjectileSimulationSubsystem::StartSweep(FSimulatedProjectile& Simulated, float StepSize)
+{
+	const int32 Steps = FMath::FloorToInt(Simulated.TimeAccumulator / StepSize);
+	if(Steps <= 0) return;
+	Simulated.TimeAccumulator -= Steps * StepSize;
+
+	// 半隐式欧拉，固定步长
+	FVector Location = Simulated.Location;
+	FVector Velocity = Simulated.Velocity;
+	for(int32 Step = 0; Step < Steps; ++Step)
+	{
+		Velocity.Z += Simulated.GravityZ * StepSize;
+		if(Simulated.MaxSpeed > 0.f)
+		{
+			Velocity = Velocity.GetClampedToMaxSize(Simulated.MaxSpeed);
+		}
+		Location += Velocity * StepSize;
+	}
+
+	Simulated.PendingLocation = Location;
+	Simulated.PendingVelocity = Velocity;
+	Simulated.SweepHandle = GetWorld()->AsyncSweepByChannel(
+		EAsyncTraceType::Single,
+		Simulated.Location,
+		Location,
+		Simulated.Projectile->GetActorQuat(),
+		Simulated.CollisionChannel,
+		Simulated.Shape,
+		Simulated.QueryParams,
+		Simulated.ResponseParams);
+	Simulated.bSweepPending = true;
+}
@@ -0,0 +1,77 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ProjectileSimulationSubsystem.generated.h"
+
+class AProjectile;
+class UProjectileMovementComponent;
+
+/**
+ * 火箭弹、手雷的统一移动模拟，代替每个弹丸一个 UProjectileMovementComponent 在游戏线程上分步 Sweep
+ * 按固定步长积分（开启 Async Physics 时和物理步长一致），和帧率无关
+ * 每帧每个弹丸只发起一次 AsyncSweepByChannel，Sweep 在工作线程执行，下一帧取回结果再推进或派发命中
+ * 弹丸显示的位置总是已经确认过没有穿透的位置，比模拟结果晚一帧
+ */
+UCLASS()
+class BONG_API UProjectileSimulationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 初速度、重力、弹跳参数从移动组件读取，之后移动组件不再 Tick
+	void RegisterProjectile(AProjectile* Projectile, UProjectileMovementComponent* MovementComp);
+	void UnregisterProjectile(AProjectile* Projectile);
+
+private:
+	struct FSimulatedProjectile
+	{
+		TWeakObjectPtr<AProjectile> Projectile;
+
+		// 已经确认的位置和速度
+		FVector Location;
+		FVector Velocity;
+		// 正在等待 Sweep 结果的模拟终点
+		FVector PendingLocation;
+		FVector PendingVelocity;
+		FTraceHandle SweepHandle;
+		bool bSweepPending = false;
+		// 还没积分的时间
+		float TimeAccumulator = 0.f;
+
+		float GravityZ = 0.f;
+		float MaxSpeed = 0.f;
+		bool bRotationFollowsVelocity = true;
+		bool bShouldBounce = false;
+		float Bounciness = 0.f;
+		float Friction = 0.f;
+		float BounceVelocityStopSimulatingThreshold = 0.f;
+		// 弹跳停下后不再模拟，等手雷自己的计时器销毁
+		bool bAtRest = false;
+
+		FCollisionShape Shape;
+		ECollisionChannel CollisionChannel = ECC_WorldDynamic;
+		FCollisionResponseParams ResponseParams;
+		FCollisionQueryParams QueryParams;
+	};
+
+	struct FSimulatedHit
+	{
+		TWeakObjectPtr<AProjectile> Projectile;
+		FHitResult Hit;
+		FVector ImpactVelocity;
+	};
+
+	// 返回 false 表示弹丸已经停止模拟，需要移除
+	bool ConsumeSweepResult(FSimulatedProjectile& Simulated, const FTraceDatum& SweepData, TArray<FSimulatedHit>& OutHits);
+	void StartSweep(FSimulatedProjectile& Simulated, float StepSize);
+
+	TArray<FSimulatedProjectile> Projectiles;
+};
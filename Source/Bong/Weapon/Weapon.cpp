@@ -12,12 +12,27 @@
 #include "Engine/SkeletalMeshSocket.h"
 #include "Bong/PlayerController/BongPlayerController.h"
 #include "Bong/BongComponents/CombatActorComponent.h"
+#include "Engine/AssetManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Sound/SoundCue.h"
+#include "WeaponPickupSubsystem.h"
 //#include "Bong/Weapon/WeaponTypes.h"
 
+DEFINE_LOG_CATEGORY_STATIC(BongWeapon, Log, All);
+
+namespace WeaponAssetBundles
+{
+	const FName Dropped = FName("Dropped");
+	const FName Equipped = FName("Equipped");
+	const FName FirstPerson = FName("FirstPerson");
+}
+
 AWeapon::AWeapon(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
-	PrimaryActorTick.bCanEverTick = false;
+	// 只在客户端插值丢下的武器时开启
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 	// 让该Actor对象里的状态属性可复制，总开关
 	bReplicates = true;
 	// 确保客户端和服务端的落点位置 完全一样，以免捡武器没问题
@@ -31,6 +46,7 @@ AWeapon::AWeapon(const FObjectInitializer& ObjectInitializer)
 	WeaponMesh->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Ignore); //人物可以走过去
 	WeaponMesh->SetCollisionResponseToChannel(ECollisionChannel::ECC_Camera, ECollisionResponse::ECR_Ignore); // 解决人物被杀，枪掉落和相机卡位的问题，其实还有碰撞通道ECC_SkeletalMesh
 	WeaponMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision); //需要时再开启
+	WeaponMesh->BodyInstance.bGenerateWakeEvents = true; // 服务端靠休眠事件冻结丢下的武器
 
 	WeaponMesh->SetCustomDepthStencilValue(CUSTOM_DEPTH_BLUE);
 	WeaponMesh->MarkRenderStateDirty(); // 强制刷新
@@ -59,14 +75,10 @@ void AWeapon::BeginPlay()
 	Super::BeginPlay();
 
 	// if(GetLocalRole() == ENetRole::ROLE_Authority)
-	if (HasAuthority())
+	// 只希望拾取检测放在服务器，Server统一安排；场景里摆放的武器一开始就可以拾取
+	if (HasAuthority() && WeaponState == EWeaponState::EWS_Initial)
 	{
-		// 开启碰撞流程
-		AreaSphere->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-		AreaSphere->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Overlap);
-		// 只希望交叠事件放在服务器，Server统一安排
-		AreaSphere->OnComponentBeginOverlap.AddDynamic(this, &AWeapon::OnSphereOverlap);
-		AreaSphere->OnComponentEndOverlap.AddDynamic(this, &AWeapon::OnSphereEndOverlap);
+		SetPickupRegistered(true);
 	}
 	if (PickupWidget)
 	{
@@ -77,6 +89,121 @@ void AWeapon::BeginPlay()
 void AWeapon::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
+
+	if(bInterpolatingDrop)
+	{
+		TickDropInterpolation();
+	}
+}
+
+void AWeapon::LoadAssetBundle(FName Bundle, FSimpleDelegate OnLoaded)
+{
+	if(IsNetMode(NM_DedicatedServer)) return;
+
+	TSharedPtr<FStreamableHandle>* Handle = AssetBundleHandles.Find(Bundle);
+	if(Handle == nullptr)
+	{
+		TArray<FSoftObjectPath> Paths;
+		GetAssetBundlePaths(Bundle, Paths);
+		Paths.RemoveAll([](const FSoftObjectPath& Path) { return Path.IsNull(); });
+		if(Paths.Num() == 0)
+		{
+			// 空句柄表示这一组没有要加载的资源，IsAssetBundleLoaded 据此返回 true
+			AssetBundleHandles.Add(Bundle, nullptr);
+			OnLoaded.ExecuteIfBound();
+			return;
+		}
+
+		// 持有句柄资源才会常驻，同一类武器共享同一份资源
+		Handle = &AssetBundleHandles.Add(Bundle, UAssetManager::GetStreamableManager().RequestAsyncLoad(
+			Paths,
+			FStreamableDelegate::CreateUObject(this, &AWeapon::OnAssetBundleLoaded, Bundle),
+			FStreamableManager::AsyncLoadHighPriority));
+	}
+
+	if(!OnLoaded.IsBound()) return;
+
+	if(!Handle->IsValid() || (*Handle)->HasLoadCompleted())
+	{
+		OnLoaded.Execute();
+	}
+	else
+	{
+		PendingAssetBundleCallbacks.FindOrAdd(Bundle).Add(MoveTemp(OnLoaded));
+	}
+}
+
+void AWeapon::OnAssetBundleLoaded(FName Bundle)
+{
+	TArray<FSimpleDelegate> Callbacks;
+	if(PendingAssetBundleCallbacks.RemoveAndCopyValue(Bundle, Callbacks))
+	{
+		for(FSimpleDelegate& Callback : Callbacks)
+		{
+			Callback.ExecuteIfBound();
+		}
+	}
+}
+
+bool AWeapon::IsAssetBundleLoaded(FName Bundle) const
+{
+	if(IsNetMode(NM_DedicatedServer)) return true;
+
+	const TSharedPtr<FStreamableHandle>* Handle = AssetBundleHandles.Find(Bundle);
+	return Handle && (!Handle->IsValid() || (*Handle)->HasLoadCompleted());
+}
+
+void AWeapon::LogCosmeticAssetNotLoaded(const FSoftObjectPath& Path) const
+{
+#if !UE_BUILD_SHIPPING
+	UE_LOG(BongWeapon, Verbose, TEXT("%s: %s 还没加载完，跳过这次表现"), *GetName(), *Path.ToString());
+#endif
+}
+
+void AWeapon::UnloadAssetBundle(FName Bundle)
+{
+	PendingAssetBundleCallbacks.Remove(Bundle);
+
+	TSharedPtr<FStreamableHandle> Handle;
+	if(AssetBundleHandles.RemoveAndCopyValue(Bundle, Handle) && Handle.IsValid())
+	{
+		Handle->ReleaseHandle();
+	}
+}
+
+void AWeapon::PlayEquippingSound()
+{
+	LoadAssetBundle(WeaponAssetBundles::Equipped, FSimpleDelegate::CreateWeakLambda(this, [this]()
+	{
+		// 加载期间又被扔掉了就不播
+		USoundCue* Sound = EquippingSound.Get();
+		if(Sound && WeaponState != EWeaponState::EWS_Dropped)
+		{
+			UGameplayStatics::PlaySoundAtLocation(this, Sound, GetActorLocation());
+		}
+	}));
+}
+
+void AWeapon::GetAssetBundlePaths(FName Bundle, TArray<FSoftObjectPath>& OutPaths) const
+{
+	if(Bundle == WeaponAssetBundles::Dropped)
+	{
+		// 本地玩家可能马上捡起，先把装备后要用的资源加载好
+		GetAssetBundlePaths(WeaponAssetBundles::Equipped, OutPaths);
+	}
+	else if(Bundle == WeaponAssetBundles::Equipped)
+	{
+		OutPaths.Add(EquippingSound.ToSoftObjectPath());
+		OutPaths.Add(FireAnimation.ToSoftObjectPath());
+	}
+	else if(Bundle == WeaponAssetBundles::FirstPerson)
+	{
+		OutPaths.Add(CrosshairsCenter.ToSoftObjectPath());
+		OutPaths.Add(CrosshairsTop.ToSoftObjectPath());
+		OutPaths.Add(CrosshairsBottom.ToSoftObjectPath());
+		OutPaths.Add(CrosshairsLeft.ToSoftObjectPath());
+		OutPaths.Add(CrosshairsRight.ToSoftObjectPath());
+	}
 }
 
 void AWeapon::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -85,25 +212,43 @@ void AWeapon::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeP
 
 	DOREPLIFETIME(AWeapon, WeaponState);
 	DOREPLIFETIME(AWeapon, Ammo);
+	DOREPLIFETIME(AWeapon, DropState);
 }
 
-// 该回调函数只绑定在了服务器
-void AWeapon::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+void AWeapon::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	ABongCharacter* BlasterCharacter = Cast<ABongCharacter>(OtherActor);
-	if (BlasterCharacter)
+	if (HasAuthority())
 	{
-		BlasterCharacter->SetOverlappingWeapon(this); //让OverlappingWeapon有效
+		SetPickupRegistered(false);
 	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
-void AWeapon::OnSphereEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+// Character 定时查询附近的武器，代替原来 AreaSphere 的交叠回调 @see ABongCharacter::UpdateOverlappingWeapon
+void AWeapon::SetPickupRegistered(bool bRegistered)
 {
-	ABongCharacter* BlasterCharacter = Cast<ABongCharacter>(OtherActor);
-	if (BlasterCharacter)
+	UWeaponPickupSubsystem* PickupSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UWeaponPickupSubsystem>() : nullptr;
+	if (PickupSubsystem == nullptr) return;
+
+	if (bRegistered)
 	{
-		BlasterCharacter->SetOverlappingWeapon(nullptr);
+		PickupSubsystem->RegisterWeapon(this);
 	}
+	else
+	{
+		PickupSubsystem->UnregisterWeapon(this);
+	}
+}
+
+FVector AWeapon::GetPickupLocation() const
+{
+	return AreaSphere ? AreaSphere->GetComponentLocation() : GetActorLocation();
+}
+
+float AWeapon::GetPickupRadius() const
+{
+	return AreaSphere ? AreaSphere->GetScaledSphereRadius() : 0.f;
 }
 
 
@@ -119,6 +264,12 @@ void AWeapon::SetHUDAmmo()
 		if(BongOwnerPlayerController)
 		{
 			BongOwnerPlayerController->SetHUDWeaponAmmo(Ammo);
+
+			// 两端换了 Owner 都会走到这里，准星只有本地持有者需要
+			if(BongOwnerPlayerController->IsLocalController())
+			{
+				LoadAssetBundle(WeaponAssetBundles::FirstPerson);
+			}
 		}
 	}
 }
@@ -176,7 +327,16 @@ void AWeapon::SetWeaponState(EWeaponState State)
 		// ---------- 大体上捡起时，关闭碰撞流程 ---------- //
 	case EWeaponState::EWS_EquippedFirst:
 		ShowPickupWidget(false);
-		AreaSphere->SetCollisionEnabled(ECollisionEnabled::NoCollision); // 服务端关球体碰撞，以免带着武器和其他玩家碰撞有交叠; 装备武器：需要考虑关闭物理模拟优先级，已经在本地优先设置，不用再判断
+		// 服务端移除拾取登记，以免带着武器还能被其他玩家拾取; 装备武器：需要考虑关闭物理模拟优先级，已经在本地优先设置，不用再判断
+		if(HasAuthority())
+		{
+			SetPickupRegistered(false);
+
+			GetWorldTimerManager().ClearTimer(DropSettleTimer);
+			WeaponMesh->OnComponentSleep.RemoveDynamic(this, &AWeapon::OnWeaponMeshSleep);
+			SetReplicateMovement(true);
+		}
+		StopDropInterpolation();
 		
 		WeaponMesh->SetSimulatePhysics(false);
 		WeaponMesh->SetEnableGravity(false);
@@ -191,18 +351,29 @@ void AWeapon::SetWeaponState(EWeaponState State)
 		// }
 		
 		EnableCustomDepth(false);
+		LoadAssetBundle(WeaponAssetBundles::Equipped);
+		// Equipped 持有资源后，预热用的句柄可以放掉了
+		UnloadAssetBundle(WeaponAssetBundles::Dropped);
 		break;
 
 
 		// ---------- 大体上扔下时，开启碰撞流程 ---------- //
 	case EWeaponState::EWS_Dropped:
+		WeaponMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+		// 物理模拟和拾取登记只有 服务端有资格; Dropped武器：现在客户端 服务端都有可能调用这个函数，所以要确保是服务端
 		if(HasAuthority())
 		{
-			AreaSphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly); // 开启非模型的交互碰撞只有 服务端有资格; Dropped武器：现在客户端 服务端都有可能调用这个函数，所以要确保是服务端
+			WeaponMesh->SetSimulatePhysics(true); // 放在后面执行，会在空中停顿
+			WeaponMesh->SetEnableGravity(true);
+
+			// 休眠后冻结，之后只复制一次最终位置，不再每帧复制移动
+			SetReplicateMovement(false);
+			WeaponMesh->OnComponentSleep.AddUniqueDynamic(this, &AWeapon::OnWeaponMeshSleep);
+			GetWorldTimerManager().SetTimer(DropSettleTimer, this, &AWeapon::FreezeDropped, MaxDropSimulateTime);
+
+			// 放在开启物理之后，网格会把还在掉落的武器当作移动中的武器跟踪
+			SetPickupRegistered(true);
 		}
-		WeaponMesh->SetSimulatePhysics(true); // 放在后面执行，会在空中停顿
-		WeaponMesh->SetEnableGravity(true);
-		WeaponMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
 		// // Begin 照顾SMG搞特殊，扔枪后，确保SMG 返回至CDO状态
 		// WeaponMesh->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Block);
 		// WeaponMesh->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Ignore); // 人物可以走过去
@@ -212,6 +383,9 @@ void AWeapon::SetWeaponState(EWeaponState State)
 		WeaponMesh->SetCustomDepthStencilValue(CUSTOM_DEPTH_BLUE);
 		WeaponMesh->MarkRenderStateDirty(); // 强制刷新
 		EnableCustomDepth(true);
+		// 拾取用的资源保留，装备后的资源放掉
+		UnloadAssetBundle(WeaponAssetBundles::Equipped);
+		UnloadAssetBundle(WeaponAssetBundles::FirstPerson);
 		break;
 	}
 }
@@ -247,12 +421,16 @@ void AWeapon::OnRep_WeaponState()
 		// }
 
 		EnableCustomDepth(false);
+		LoadAssetBundle(WeaponAssetBundles::Equipped);
+		// Equipped 持有资源后，预热用的句柄可以放掉了
+		UnloadAssetBundle(WeaponAssetBundles::Dropped);
 		break;
 
 	case EWeaponState::EWS_Dropped:
-		WeaponMesh->SetSimulatePhysics(true);
-		WeaponMesh->SetEnableGravity(true);
+		// 客户端不模拟物理，按服务端的 DropState 插值
 		WeaponMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+		DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+		StartDropInterpolation();
 		// // Begin 照顾SMG搞特殊，扔枪后，确保SMG 返回至CDO状态
 		// WeaponMesh->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Block);
 		// WeaponMesh->SetCollisionResponseToChannel(ECollisionChannel::ECC_Pawn, ECollisionResponse::ECR_Ignore); // 人物可以走过去
@@ -262,6 +440,9 @@ void AWeapon::OnRep_WeaponState()
 		WeaponMesh->SetCustomDepthStencilValue(CUSTOM_DEPTH_BLUE);
 		WeaponMesh->MarkRenderStateDirty(); // 强制刷新
 		EnableCustomDepth(true);
+		// 拾取用的资源保留，装备后的资源放掉
+		UnloadAssetBundle(WeaponAssetBundles::Equipped);
+		UnloadAssetBundle(WeaponAssetBundles::FirstPerson);
 		break;
 	}
 }
@@ -272,14 +453,19 @@ void AWeapon::ShowPickupWidget(bool bShowWidget)
 	{
 		PickupWidget->SetVisibility(bShowWidget);
 	}
+	// 只有本地玩家靠近时才会显示
+	if(bShowWidget)
+	{
+		LoadAssetBundle(WeaponAssetBundles::Dropped);
+	}
 }
 
 // 多播RPC 使Fire() 在每台Machine上执行
 void AWeapon::Fire(const FVector& HitTarget)
 {
-	if(FireAnimation)
+	if(UAnimationAsset* Animation = GetCosmeticAsset(FireAnimation))
 	{
-		WeaponMesh->PlayAnimation(FireAnimation, false);
+		WeaponMesh->PlayAnimation(Animation, false);
 	}
 	
 	/** 生成弹壳的起点 */
@@ -307,10 +493,19 @@ void AWeapon::Fire(const FVector& HitTarget)
 // 为了后续的流程考虑，确保只在服务端调用
 void AWeapon::Dropped()
 {
+	// 武器带着持有者的速度离手；刚开启物理的这一帧网格速度还是 0，不能直接读
+	const FVector DropVelocity = GetOwner() ? GetOwner()->GetVelocity() : FVector::ZeroVector;
+
 	SetWeaponState(EWeaponState::EWS_Dropped);
 
 	const FDetachmentTransformRules DetachRule(EDetachmentRule::KeepWorld, true);
 	WeaponMesh->DetachFromComponent(DetachRule);
+	// 服务端物理和客户端抛物线用同一个初速度
+	WeaponMesh->SetPhysicsLinearVelocity(DropVelocity);
+
+	DropState.StartLocation = GetActorLocation();
+	DropState.StartVelocity = DropVelocity;
+	DropState.bAtRest = false;
 
 	// 会调用OnRep_Owner
 	SetOwner(nullptr);
@@ -320,6 +515,99 @@ void AWeapon::Dropped()
 	BongOwnerPlayerController = nullptr;
 }
 
+// 服务端
+void AWeapon::OnWeaponMeshSleep(UPrimitiveComponent* SleepingComponent, FName BoneName)
+{
+	FreezeDropped();
+}
+
+void AWeapon::FreezeDropped()
+{
+	GetWorldTimerManager().ClearTimer(DropSettleTimer);
+	WeaponMesh->OnComponentSleep.RemoveDynamic(this, &AWeapon::OnWeaponMeshSleep);
+	if(WeaponState != EWeaponState::EWS_Dropped) return;
+
+	WeaponMesh->SetSimulatePhysics(false);
+
+	DropState.RestLocation = GetActorLocation();
+	DropState.RestRotation = GetActorRotation();
+	DropState.bAtRest = true;
+	ForceNetUpdate();
+}
+
+void AWeapon::OnRep_DropState()
+{
+	// 和 WeaponState 同一包到达时，等 OnRep_WeaponState 解除附着后再开始
+	if(WeaponState == EWeaponState::EWS_Dropped)
+	{
+		StartDropInterpolation();
+	}
+}
+
+void AWeapon::StartDropInterpolation()
+{
+	const float Now = GetWorld()->GetTimeSeconds();
+
+	if(DropState.bAtRest)
+	{
+		RestBlendStartTime = Now;
+		RestBlendStartLocation = GetActorLocation();
+		RestBlendStartRotation = GetActorQuat();
+	}
+	else if(!bInterpolatingDrop)
+	{
+		DropStartTime = Now;
+
+		// 抛物线不做碰撞，只在开始时往下找一次地面，避免穿到地下
+		FHitResult GroundHit;
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(WeaponDropGround), false, this);
+		const FVector GroundTraceEnd = DropState.StartLocation - FVector(0.f, 0.f, 10000.f);
+		if(GetWorld()->LineTraceSingleByChannel(GroundHit, DropState.StartLocation, GroundTraceEnd, ECC_Visibility, QueryParams))
+		{
+			// 抛物线上只平移不旋转，原点到网格底部的距离保持不变，用它把网格底部而不是原点贴在地面上
+			const float BottomOffset = GetActorLocation().Z - WeaponMesh->Bounds.GetBox().Min.Z;
+			DropGroundZ = GroundHit.ImpactPoint.Z + FMath::Max(BottomOffset, 0.f);
+		}
+		else
+		{
+			DropGroundZ = -BIG_NUMBER;
+		}
+	}
+
+	bInterpolatingDrop = true;
+	SetActorTickEnabled(true);
+}
+
+void AWeapon::StopDropInterpolation()
+{
+	bInterpolatingDrop = false;
+	SetActorTickEnabled(false);
+}
+
+void AWeapon::TickDropInterpolation()
+{
+	const float Now = GetWorld()->GetTimeSeconds();
+
+	if(DropState.bAtRest)
+	{
+		const float Alpha = RestBlendTime > 0.f ? FMath::Clamp((Now - RestBlendStartTime) / RestBlendTime, 0.f, 1.f) : 1.f;
+		SetActorLocationAndRotation(
+			FMath::Lerp(RestBlendStartLocation, FVector(DropState.RestLocation), Alpha),
+			FQuat::Slerp(RestBlendStartRotation, DropState.RestRotation.Quaternion(), Alpha));
+
+		if(Alpha >= 1.f)
+		{
+			StopDropInterpolation();
+		}
+		return;
+	}
+
+	const float DropTime = Now - DropStartTime;
+	FVector Location = DropState.StartLocation + DropState.StartVelocity * DropTime + FVector(0.f, 0.f, 0.5f * GetWorld()->GetGravityZ() * DropTime * DropTime);
+	Location.Z = FMath::Max(Location.Z, DropGroundZ);
+	SetActorLocation(Location);
+}
+
 void AWeapon::AddAmmo(int32 AmmoToAdd)
 {
 	Ammo = FMath::Clamp(Ammo + AmmoToAdd, 0, MagCapacity);
@@ -28,6 +28,35 @@ enum class EFireType : uint8
 	EFT_MAX						UMETA(DisplayName = "DefaultMAX")
 };
 
+// 武器外观资源按使用场景分组，软引用按需异步加载，地图里的武器不会把整套资源拖进内存
+namespace WeaponAssetBundles
+{
+	extern BONG_API const FName Dropped; // 本地玩家靠近，可以拾取时预热 Equipped 的资源，捡起后释放
+	extern BONG_API const FName Equipped; // 被装备后，所有端
+	extern BONG_API const FName FirstPerson; // 只给本地持有者
+}
+
+
+// 丢下的武器只在服务端模拟物理，客户端按这里的数据插值
+USTRUCT()
+struct FWeaponDropState
+{
+	GENERATED_BODY()
+
+	// 丢下时的位置和速度，客户端据此算出抛物线
+	UPROPERTY()
+	FVector_NetQuantize StartLocation;
+	UPROPERTY()
+	FVector_NetQuantize10 StartVelocity;
+
+	// 服务端物理休眠后的最终位置，只在停下时复制一次
+	UPROPERTY()
+	FVector_NetQuantize RestLocation;
+	UPROPERTY()
+	FRotator RestRotation = FRotator::ZeroRotator;
+	UPROPERTY()
+	bool bAtRest = false;
+};
 
 class UTexture2D;
 class USkeletalMeshComponent;
@@ -38,6 +67,7 @@ class ACasing;
 class ABongCharacter;
 class ABongPlayerController;
 class USoundCue;
+struct FStreamableHandle;
 
 
 UCLASS()
@@ -56,19 +86,29 @@ public:
 	virtual void Fire(const FVector& HitTarget);
 	void Dropped();
 	void AddAmmo(int32 AmmoToAdd);
+
+	// 专用服务器不加载外观资源；资源未加载完之前对应的软引用 Get() 为空
+	// OnLoaded 在这一组加载完后调用（已经加载完就立即调用），加载完之前被 Unload 就不再调用
+	void LoadAssetBundle(FName Bundle, FSimpleDelegate OnLoaded = FSimpleDelegate());
+	void UnloadAssetBundle(FName Bundle);
+	// 专用服务器不加载，总是返回 true；本地开火前要等 Equipped 组加载完
+	bool IsAssetBundleLoaded(FName Bundle) const;
+
+	// 装备音效要等 Equipped 组加载完再播放，服务端和每个客户端各自调用
+	void PlayEquippingSound();
 	
 	// 十字准线在武器上，取决于武器
-	UPROPERTY(EditAnywhere, Category = Crosshairs)
-	TObjectPtr<UTexture2D> CrosshairsCenter;
+	UPROPERTY(EditAnywhere, Category = Crosshairs, meta = (AssetBundles = "FirstPerson"))
+	TSoftObjectPtr<UTexture2D> CrosshairsCenter;
 	
-	UPROPERTY(EditAnywhere, Category = Crosshairs)
-	TObjectPtr<UTexture2D> CrosshairsTop;
-	UPROPERTY(EditAnywhere, Category = Crosshairs)
-	TObjectPtr<UTexture2D> CrosshairsBottom;
-	UPROPERTY(EditAnywhere, Category = Crosshairs)
-	TObjectPtr<UTexture2D> CrosshairsLeft;
-	UPROPERTY(EditAnywhere, Category = Crosshairs)
-	TObjectPtr<UTexture2D> CrosshairsRight;
+	UPROPERTY(EditAnywhere, Category = Crosshairs, meta = (AssetBundles = "FirstPerson"))
+	TSoftObjectPtr<UTexture2D> CrosshairsTop;
+	UPROPERTY(EditAnywhere, Category = Crosshairs, meta = (AssetBundles = "FirstPerson"))
+	TSoftObjectPtr<UTexture2D> CrosshairsBottom;
+	UPROPERTY(EditAnywhere, Category = Crosshairs, meta = (AssetBundles = "FirstPerson"))
+	TSoftObjectPtr<UTexture2D> CrosshairsLeft;
+	UPROPERTY(EditAnywhere, Category = Crosshairs, meta = (AssetBundles = "FirstPerson"))
+	TSoftObjectPtr<UTexture2D> CrosshairsRight;
 	
 	/*
 	 * Zoomed FOV while aiming
@@ -86,8 +126,9 @@ public:
 	UPROPERTY(EditAnywhere, Category = Combat)
 	bool bAutomatic = true;
 
-	UPROPERTY(EditAnywhere)
-	TObjectPtr<USoundCue> EquippingSound;
+	// 所有端装备时都要播放，和其他装备后的资源一起加载
+	UPROPERTY(EditAnywhere, meta = (AssetBundles = "Equipped"))
+	TSoftObjectPtr<USoundCue> EquippingSound;
 
 	/*
 	 * Enable or disable custom depth
@@ -96,29 +137,33 @@ public:
 	
 protected:
 	virtual void BeginPlay() override;
-
-	UFUNCTION()
-	virtual void OnSphereOverlap(
-		UPrimitiveComponent* OverlappedComponent,
-		AActor* OtherActor,
-		UPrimitiveComponent* OtherComp,
-		int32 OtherBodyIndex,
-		bool bFromSweep,
-		const FHitResult& SweepResult
-	);
-
-	UFUNCTION()
-	void OnSphereEndOverlap(
-		UPrimitiveComponent* OverlappedComponent,
-		AActor* OtherActor,
-		UPrimitiveComponent* OtherComp,
-		int32 OtherBodyIndex
-	);
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	// 子类把自己的软引用资源追加到对应的分组里
+	virtual void GetAssetBundlePaths(FName Bundle, TArray<FSoftObjectPath>& OutPaths) const;
+
+	// 开火时用的资源：只取已经加载的，没加载完就跳过这次表现，不在开火时同步加载；专用服务器返回空
+	template<typename T>
+	T* GetCosmeticAsset(const TSoftObjectPtr<T>& Asset) const
+	{
+		if(Asset.IsNull() || IsNetMode(NM_DedicatedServer)) return nullptr;
+		T* Loaded = Asset.Get();
+		if(Loaded == nullptr)
+		{
+			LogCosmeticAssetNotLoaded(Asset.ToSoftObjectPath());
+		}
+		return Loaded;
+	}
+	void LogCosmeticAssetNotLoaded(const FSoftObjectPath& Path) const;
+
+	// 服务端在 UWeaponPickupSubsystem 里登记/移除可拾取的武器
+	void SetPickupRegistered(bool bRegistered);
 
 private:
 	UPROPERTY(VisibleAnywhere, Category = "Weapon Properties")
 	USkeletalMeshComponent* WeaponMesh;
 
+	// 不再参与碰撞，只用它的位置和半径作为拾取范围 @see UWeaponPickupSubsystem
 	UPROPERTY(VisibleAnywhere, Category = "Weapon Properties")
 	USphereComponent* AreaSphere;
 
@@ -128,14 +173,53 @@ private:
 	UFUNCTION()
 	void OnRep_WeaponState();
 
+	/*
+	 * Drop and settle
+	 */
+	UPROPERTY(ReplicatedUsing = OnRep_DropState)
+	FWeaponDropState DropState;
+
+	UFUNCTION()
+	void OnRep_DropState();
+
+	// 一直没有休眠（比如落在会动的东西上）也会在这个时间后冻结
+	UPROPERTY(EditDefaultsOnly, Category = "Weapon Properties")
+	float MaxDropSimulateTime = 5.f;
+	// 客户端从抛物线过渡到最终位置的时间
+	UPROPERTY(EditDefaultsOnly, Category = "Weapon Properties")
+	float RestBlendTime = 0.15f;
+
+	FTimerHandle DropSettleTimer;
+
+	UFUNCTION()
+	void OnWeaponMeshSleep(UPrimitiveComponent* SleepingComponent, FName BoneName);
+	void FreezeDropped();
+
+	// 客户端
+	void StartDropInterpolation();
+	void StopDropInterpolation();
+	void TickDropInterpolation();
+	bool bInterpolatingDrop = false;
+	float DropStartTime = 0.f;
+	// 抛物线上 Actor 原点允许的最低高度：地面加上原点到网格包围盒底部的距离
+	float DropGroundZ = -BIG_NUMBER;
+	float RestBlendStartTime = 0.f;
+	FVector RestBlendStartLocation;
+	FQuat RestBlendStartRotation;
+
 	UPROPERTY(VisibleAnywhere, Category = "Weapon Properties")
 	UWidgetComponent* PickupWidget;
-	UPROPERTY(EditDefaultsOnly, Category = "Weapon Properties")
-	TObjectPtr<UAnimationAsset> FireAnimation;
+	UPROPERTY(EditDefaultsOnly, Category = "Weapon Properties", meta = (AssetBundles = "Equipped"))
+	TSoftObjectPtr<UAnimationAsset> FireAnimation;
 	// 不需要在构造函数初始化，Runtime时用于SpawnActor
 	UPROPERTY(EditAnywhere)
 	TSubclassOf<ACasing> CasingClass;
 
+	TMap<FName, TSharedPtr<FStreamableHandle>> AssetBundleHandles;
+	// 还在加载中的分组，加载完后要调用的回调
+	TMap<FName, TArray<FSimpleDelegate>> PendingAssetBundleCallbacks;
+	void OnAssetBundleLoaded(FName Bundle);
+
 	/*
 	 * Ammo
 	 */
@@ -166,6 +250,8 @@ public:
 	void SetWeaponState(EWeaponState State);
 	
 	FORCEINLINE USphereComponent* GetAreaSphere() const { return AreaSphere; }
+	FVector GetPickupLocation() const;
+	float GetPickupRadius() const;
 	FORCEINLINE USkeletalMeshComponent* GetWeaponMesh() const { return WeaponMesh; }
 	FORCEINLINE float GetZoomedFOV() const { return ZoomedFOV; }
 	FORCEINLINE float GetZoomInterpSpeed() const { return ZoomInterpSpeed; }
@@ -0,0 +1,159 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "WeaponPickupSubsystem.h"
+#include "Weapon.h"
+#include "Components/SkeletalMeshComponent.h"
+
+
+namespace WeaponPickup
+{
+	// 比常见的拾取半径大一些，大多数查询只需要看周围 3x3 个格子
+	constexpr float CellSize = 400.f;
+}
+
+
+void UWeaponPickupSubsystem::Deinitialize()
+{
+	Cells.Empty();
+	WeaponCells.Empty();
+	MovingWeapons.Empty();
+
+	Super::Deinitialize();
+}
+
+void UWeaponPickupSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if(MovingWeapons.Num() == 0) return;
+
+	for(int32 Index = MovingWeapons.Num() - 1; Index >= 0; --Index)
+	{
+		AWeapon* Weapon = MovingWeapons[Index].Get();
+		const FIntPoint* OldCellCoord = Weapon ? WeaponCells.Find(Weapon) : nullptr;
+		if(OldCellCoord == nullptr)
+		{
+			MovingWeapons.RemoveAtSwap(Index);
+			continue;
+		}
+
+		const FIntPoint NewCellCoord = GetCellCoord(Weapon->GetPickupLocation());
+		if(NewCellCoord != *OldCellCoord)
+		{
+			RemoveFromCell(Weapon, *OldCellCoord);
+			AddToCell(Weapon, NewCellCoord);
+			WeaponCells.Add(Weapon, NewCellCoord);
+		}
+
+		// 物理休眠后位置不再变化
+		USkeletalMeshComponent* WeaponMesh = Weapon->GetWeaponMesh();
+		if(WeaponMesh == nullptr || !WeaponMesh->IsSimulatingPhysics() || !WeaponMesh->RigidBodyIsAwake())
+		{
+			MovingWeapons.RemoveAtSwap(Index);
+		}
+	}
+
+	// 同一格子里的移动也可能进出拾取范围
+	++Version;
+}
+
+TStatId UWeaponPickupSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UWeaponPickupSubsystem, STATGROUP_Tickables);
+}
+
+void UWeaponPickupSubsystem::RegisterWeapon(AWeapon* Weapon)
+{
+	if(Weapon == nullptr) return;
+
+	UnregisterWeapon(Weapon);
+
+	const FIntPoint CellCoord = GetCellCoord(Weapon->GetPickupLocation());
+	AddToCell(Weapon, CellCoord);
+	WeaponCells.Add(Weapon, CellCoord);
+
+	if(Weapon->GetWeaponMesh() && Weapon->GetWeaponMesh()->IsSimulatingPhysics())
+	{
+		MovingWeapons.AddUnique(Weapon);
+	}
+
+	MaxPickupRadius = FMath::Max(MaxPickupRadius, Weapon->GetPickupRadius());
+	++Version;
+}
+
+void UWeaponPickupSubsystem::UnregisterWeapon(AWeapon* Weapon)
+{
+	FIntPoint CellCoord;
+	if(Weapon && WeaponCells.RemoveAndCopyValue(Weapon, CellCoord))
+	{
+		RemoveFromCell(Weapon, CellCoord);
+		MovingWeapons.RemoveSwap(Weapon);
+		++Version;
+	}
+}
+
+AWeapon* UWeaponPickupSubsystem::FindNearestWeapon(const FVector& Location, float CapsuleRadius, float CapsuleHalfHeight) const
+{
+	const int32 CellRange = FMath::CeilToInt((MaxPickupRadius + CapsuleRadius) / WeaponPickup::CellSize);
+	const FIntPoint CenterCellCoord = GetCellCoord(Location);
+
+	AWeapon* NearestWeapon = nullptr;
+	float NearestDistanceSquared = TNumericLimits<float>::Max();
+
+	for(int32 X = -CellRange; X <= CellRange; ++X)
+	{
+		for(int32 Y = -CellRange; Y <= CellRange; ++Y)
+		{
+			const TArray<TWeakObjectPtr<AWeapon>>* Cell = Cells.Find(CenterCellCoord + FIntPoint(X, Y));
+			if(Cell == nullptr) continue;
+
+			for(const TWeakObjectPtr<AWeapon>& WeakWeapon : *Cell)
+			{
+				AWeapon* Weapon = WeakWeapon.Get();
+				if(Weapon == nullptr) continue;
+
+				// 和原来球体与胶囊体的交叠近似：水平方向看半径，竖直方向看半高
+				const float PickupRadius = Weapon->GetPickupRadius();
+				const FVector Offset = Weapon->GetPickupLocation() - Location;
+				if(Offset.SizeSquared2D() > FMath::Square(PickupRadius + CapsuleRadius) || FMath::Abs(Offset.Z) > PickupRadius + CapsuleHalfHeight)
+				{
+					continue;
+				}
+
+				const float DistanceSquared = Offset.SizeSquared();
+				if(DistanceSquared < NearestDistanceSquared)
+				{
+					NearestDistanceSquared = DistanceSquared;
+					NearestWeapon = Weapon;
+				}
+			}
+		}
+	}
+
+	return NearestWeapon;
+}
+
+FIntPoint UWeaponPickupSubsystem::GetCellCoord(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt(Location.X / WeaponPickup::CellSize),
+		FMath::FloorToInt(Location.Y / WeaponPickup::CellSize));
+}
+
+void UWeaponPickupSubsystem::AddToCell(AWeapon* Weapon, const FIntPoint& CellCoord)
+{
+	Cells.FindOrAdd(CellCoord).Add(Weapon);
+}
+
+void UWeaponPickupSubsystem::RemoveFromCell(AWeapon* Weapon, const FIntPoint& CellCoord)
+{
+	if(TArray<TWeakObjectPtr<AWeapon>>* Cell = Cells.Find(CellCoord))
+	{
+		Cell->RemoveSwap(Weapon);
+		if(Cell->Num() == 0)
+		{
+			Cells.Remove(CellCoord);
+		}
+	}
+}
@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WeaponPickupSubsystem.generated.h"
+
+class AWeapon;
+
+/**
+ * 服务端可拾取武器的均匀网格，代替每把武器一个 AreaSphere 的交叠检测
+ * 武器数量再多也只查询 Character 附近的几个格子，不再有一堆交叠体参与 Broadphase
+ */
+UCLASS()
+class BONG_API UWeaponPickupSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	// 只在服务端调用，武器处于可拾取状态时注册，被装备或销毁时移除
+	void RegisterWeapon(AWeapon* Weapon);
+	void UnregisterWeapon(AWeapon* Weapon);
+
+	// 找到和胶囊体相交的拾取范围里离得最近的武器
+	AWeapon* FindNearestWeapon(const FVector& Location, float CapsuleRadius, float CapsuleHalfHeight) const;
+
+	// 有武器注册、移除或移动时递增，Character 用它判断要不要重新查询
+	FORCEINLINE uint32 GetVersion() const { return Version; }
+
+private:
+	FIntPoint GetCellCoord(const FVector& Location) const;
+	void AddToCell(AWeapon* Weapon, const FIntPoint& CellCoord);
+	void RemoveFromCell(AWeapon* Weapon, const FIntPoint& CellCoord);
+
+	TMap<FIntPoint, TArray<TWeakObjectPtr<AWeapon>>> Cells;
+	// 每把武器当前所在的格子
+	TMap<TWeakObjectPtr<AWeapon>, FIntPoint> WeaponCells;
+	// 刚丢下还在物理模拟的武器，停下之前每帧更新所在格子
+	TArray<TWeakObjectPtr<AWeapon>> MovingWeapons;
+
+	// 查询时要覆盖的格子范围取决于最大的拾取半径
+	float MaxPickupRadius = 0.f;
+	uint32 Version = 0;
+};